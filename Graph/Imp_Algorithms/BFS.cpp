@@ -1,72 +1,86 @@
 #include<bits/stdc++.h>
+// For large low diameter graphs see direction_optimizing_BFS.cpp (multi threaded, top-down/bottom-up switching)
 // Time Complexity: O(V + E)
 // A slight modification of question: Find 2nd fastest way of reaching from source to destination. in Undirected ascyclic graph.
 // Fastest way is using normal BFS. Here we'll ne two dist arrays. dist1[]stroring 1st time we encounter a num. dist2[] we encountering 2nd time.
 //https://www.youtube.com/watch?v=_rnQKrA9xzA&t=436s&ab_channel=codestorywithMIK
 using namespace std;
-#define LIM 1007
 
-vector<int> adj[LIM];
-// vector<int> dist(LIM,-1);
-// vector<int> parent(LIM,-1);
-int visited[LIM];
-
-void addEdge(int u, int v) 
+void addEdge(vector<vector<int>>& adj, int u, int v) 
 { 
     adj[u].push_back(v);
     adj[v].push_back(u);
 } 
 
-void bfs(int src)
+// visited + queue live in the caller's Workspace; the queue is a vector that ends up holding the BFS order
+class BFS
 {
-    queue<int> q;
-    int d=0;
-    // dist[src] = d;
-    // parent[src] = -1;
-    q.push(src);
-    visited[src]=true;
-    while(!q.empty())
+private:
+    const vector<vector<int>>& adj;
+
+public:
+    struct Workspace
     {
-        int u = q.front();
-        q.pop();
+        vector<char> visited;
+        vector<int> q;
+    };
+
+    BFS(const vector<vector<int>>& adj) : adj(adj) {}
 
-        cout<<u<<" ";
-        for(int v : adj[u])
+    // returns the vertices in visiting order (= ws.q)
+    const vector<int>& run(int src, Workspace& ws) const
+    {
+        ws.visited.assign(adj.size(), false);
+        ws.q.clear();
+        // dist[src] = 0;
+        // parent[src] = -1;
+        ws.q.push_back(src);
+        ws.visited[src]=true;
+        for(size_t head=0; head<ws.q.size(); head++)
         {
-            if(!visited[v])
+            int u = ws.q[head];
+
+            for(int v : adj[u])
             {
-                // dist[v] = dist[u] + 1;
-                // parent[v] = u;
-                
-                visited[v]=true;    //NOTE : We put visited here inside the inner loop
-                q.push(v);
+                if(!ws.visited[v])
+                {
+                    // dist[v] = dist[u] + 1;
+                    // parent[v] = u;
+                    
+                    ws.visited[v]=true;    //NOTE : We put visited here inside the inner loop
+                    ws.q.push_back(v);
+                }
+                    
             }
-                
         }
+        return ws.q;
     }
-}
+};
 
 
 int main()
 {
-    int V,i,src,u,v,wt,E;
+    int V,i,src,u,v,E;
 
     cout<<"Enter number of vertices and edges: ";
     cin>>V>>E;
     
-
+    vector<vector<int>> adj(V);
     for(i=0;i<E;i++)
     {
         cout<<i+1<<". Enter vertex name u and v:  ";
         cin>>u>>v;
-        addEdge(u,v);
+        addEdge(adj,u,v);
     }
    
 
     cout<<"Enter source node for iterative bfs: ";
     cin>>src;
     cout<<"BFS=> ";
-    bfs(src);
+    BFS bfs(adj);
+    BFS::Workspace ws;
+    for(int x : bfs.run(src, ws))
+        cout<<x<<" ";
     cout<<endl;
 
 
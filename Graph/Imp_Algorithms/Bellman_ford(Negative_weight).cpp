@@ -5,79 +5,89 @@ Complexity for Bellman Ford's Algo -> O(E*V)
 E-Edges V-Vertices
 */
 #include<bits/stdc++.h>
-#define LIM 3000
-#define INF 1e5+3
 
 using namespace std;
 
+const int INF = 1e9;
 
-//NOTE: Here reprentation of graph is done a bit differnetly 
-typedef pair<int,int> pii;
-
-vector<vector<int>> G(LIM,vector<int>(3));
-vector<int> min_dist(LIM,INF);
-int V,E;
+//NOTE: Here reprentation of graph is done a bit differnetly (list of edges instead of adjacency list)
+struct Edge
+{
+    int u, v, wt;
+};
 
 /*
 IMP NOTE: If there is a cycle with total sum negative then this algo WON'T WORK
 We baically relax the edges V-1 times
+Early exit + SPFA + parallel passes + printing the actual negative cycle -> bellman_ford_engine.cpp
+
+min_dist lives in the caller's Workspace, sized from V (no LIM)
 */
-void bellman_ford(int src)
+class BellmanFord
 {
-    min_dist[src] = 0;
-    int u,v,k;
-    for(k=0;k<V-1;k++)
+private:
+    int V;
+    const vector<Edge>& G;
+
+public:
+    struct Workspace
     {
-        for(auto itr : G)
-        {
-            int u = itr[0];
-            int v = itr[1];
-            int wt = itr[2];
+        vector<int> min_dist;
+    };
 
-            min_dist[v] = min(min_dist[v],min_dist[u]+wt);
-        }
-    }
+    BellmanFord(int V, const vector<Edge>& G) : V(V), G(G) {}
 
-    // If the min min_dist is still changing even after V-1 iterstions means there is no soln.
-    for(auto itr : G)
+    // Fills ws.min_dist (INF = unreachable), returns false if there is a negative cycle
+    bool run(int src, Workspace& ws) const
     {
-        int u = itr[0];
-        int v = itr[1];
-        int wt = itr[2];
+        vector<int>& min_dist = ws.min_dist;
+        min_dist.assign(V, INF);
+        min_dist[src] = 0;
+        for(int k=0;k<V-1;k++)
+        {
+            for(const Edge& e : G)
+            {
+                if(min_dist[e.u] != INF)
+                    min_dist[e.v] = min(min_dist[e.v],min_dist[e.u]+e.wt);
+            }
+        }
 
-        if(min_dist[v] > min_dist[u]+wt)
+        // If the min min_dist is still changing even after V-1 iterstions means there is no soln.
+        for(const Edge& e : G)
         {
-            cout << "There is a negtive cycle\n";
-            break;
+            if(min_dist[e.u] != INF && min_dist[e.v] > min_dist[e.u]+e.wt)
+                return false;
         }
+        return true;
     }
-    
-}
+};
 
 int main()
 {
-    int i,src=0,u,v,wt;
+    int i,src=0,u,v,wt,V,E;
 
     cout<<"Enter number of vertices and edges: ";
     cin>>V>>E;
     cout<<endl;
 
-    for(i=0;i<8;i++)
+    vector<Edge> G(E);
+    for(i=0;i<E;i++)
     {
         cout<<"Enter vertex name u , v and weight: ";
         cin>>u>>v>>wt;
 
-        G[i][0] = u;
-        G[i][1] = v;
-        G[i][2] = wt;
+        G[i] = {u, v, wt};
     }
     
     cout<<"Enter the source node: ";
     cin>>src;
-    bellman_ford(src);
+    BellmanFord bf(V, G);
+    BellmanFord::Workspace ws;
+    if(!bf.run(src, ws))
+        cout << "There is a negtive cycle\n";
     cout<<endl;
 
     cout<<"Min distace all nodes from "<<src<<"is:\n";
     for(int i=0;i<V;i++)
-        cout<<i<<" : "<<min_dist[i]<<endl;
+        cout<<i<<" : "<<ws.min_dist[i]<<endl;
 }
\ No newline at end of file
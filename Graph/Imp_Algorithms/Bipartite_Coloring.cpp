@@ -4,6 +4,7 @@ using namespace std;
 #define LIM 1007
 typedef enum {WHITE,GREY,BLACK} col;
 // we try ro color whole graph in 2 colors grey and black
+// dense graphs: adjacency matrix bitsets, odd cycle witness, parallel components -> bitset_bipartite.cpp
 
 
 vector<int> adj[LIM];
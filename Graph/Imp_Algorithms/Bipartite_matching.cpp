@@ -7,17 +7,40 @@
  * @ref: https://www.geeksforgeeks.org/maximum-bipartite-matching/
  * @ref: https://cp-algorithms.com/graph/kuhn_maximum_bipartite_matching.html
  * @ref: https://leetcode.com/problems/maximum-number-of-accepted-invitations/solutions/1978859/python-hungarian-algorithm-easy-to-understand/
+ * @ref: https://en.wikipedia.org/wiki/Hopcroft%E2%80%93Karp_algorithm
+ *
+ * 1. Kuhn's algorithm: one DFS (augmenting path) per applicant -> O(V*E)
+ * 2. Hopcroft-Karp: every phase
+ *      -> BFS from ALL free applicants builds layers (dist) up to the nearest free job
+ *      -> DFS finds a maximal set of vertex disjoint SHORTEST augmenting paths along the layers
+ *    Only O(sqrt(V)) phases are needed -> O(E*sqrt(V))
+ *    A greedy matching is done first so the first phase starts with most applicants already matched.
+ *    The DFS is iterative (explicit stack + per vertex edge pointer) so long paths can't overflow the stack.
+ *
+ * Sizes are taken from the input: applicants = G.size(), jobs = largest job id + 1.
  */
 
 #include <bits/stdc++.h>
 
 using namespace std;
 
-int jobs = 6, applicants = 6;
+int jobs, applicants;
+
+vector<vector<int> > G;          // G[applicant] = jobs offered to the applicant
+vector<int> currentMatching;     // Job i mapped with currentMatching[i] applicant.
+vector<bool> visited;            // Usual use so that dfs doesn't visit same vertex again
 
-vector<vector<int> > G;
-vector<int> currentMatching(jobs, -1);       // Job i mapped with currentMatching[i] applicant.
-vector<bool> visited(applicants);            // Usual use so that dfs doesn't visit same vertex again
+void init(const vector<vector<int> >& offers)
+{
+    G = offers;
+    applicants = G.size();
+    jobs = 0;
+    for (auto& row : G)
+        for (int job : row)
+            jobs = max(jobs, job + 1);
+    currentMatching.assign(jobs, -1);
+    visited.assign(applicants, false);
+}
 
 /**
  * Main idea behind the logic is a job applicant will only leave job if he/she gets some other job.
@@ -44,17 +67,8 @@ bool findMaxBiPartiteMatching(int u) // applicant
     return false;
 }
 
-int main()
+int kuhn()
 {
-    G = {
-            {1, 2}, // Applicant 0 has {1, 2} job offers
-            {0, 3}, // Applicant 1 has {0, 3} job offers 
-            {2}, 
-            {2, 3}, 
-            {}, 
-            {5}
-        };
-
     int ans = 0;
     for (int applicant = 0; applicant < applicants; applicant++)
     {
@@ -62,6 +76,145 @@ int main()
         if(findMaxBiPartiteMatching(applicant))
             ans++;
     }
+    return ans;
+}
+
+
+/**
+ * Hopcroft-Karp. matchJob[j] = applicant of job j, matchApplicant[a] = job of applicant a (-1 = free)
+ *
+ * @return int : size of maximum matching
+ */
+int hopcroftKarp(vector<int>& matchApplicant, vector<int>& matchJob)
+{
+    const int NIL = INT_MAX;
+    matchApplicant.assign(applicants, -1);
+    matchJob.assign(jobs, -1);
+    vector<int> dist(applicants), q(applicants), it(applicants), stck;
+    int ans = 0;
+
+    // Greedy initial matching: first free job for every applicant
+    for (int a = 0; a < applicants; a++)
+        for (int j : G[a])
+            if (matchJob[j] == -1) {
+                matchJob[j] = a;
+                matchApplicant[a] = j;
+                ans++;
+                break;
+            }
+
+    while (true) {
+        // BFS: layer free applicants at 0, go applicant -> job -> matched applicant
+        int head = 0, tail = 0;
+        for (int a = 0; a < applicants; a++) {
+            if (matchApplicant[a] == -1) {
+                dist[a] = 0;
+                q[tail++] = a;
+            } else {
+                dist[a] = NIL;
+            }
+        }
+        int freeJobDist = NIL;   // length of the shortest augmenting path
+        while (head < tail) {
+            int a = q[head++];
+            if (dist[a] >= freeJobDist) continue;
+            for (int j : G[a]) {
+                int b = matchJob[j];
+                if (b == -1) {
+                    if (freeJobDist == NIL) freeJobDist = dist[a] + 1;
+                } else if (dist[b] == NIL) {
+                    dist[b] = dist[a] + 1;
+                    q[tail++] = b;
+                }
+            }
+        }
+        if (freeJobDist == NIL)
+            break;    // no augmenting path left
+
+        // DFS along the layers from every free applicant, vertex disjoint paths
+        fill(it.begin(), it.end(), 0);
+        for (int s = 0; s < applicants; s++) {
+            if (matchApplicant[s] != -1) continue;
+            stck.assign(1, s);
+            while (!stck.empty()) {
+                int a = stck.back();
+                if (it[a] == (int)G[a].size()) {
+                    dist[a] = NIL;            // dead end, never try it again in this phase
+                    stck.pop_back();
+                    continue;
+                }
+                int j = G[a][it[a]];
+                int b = matchJob[j];
+                if (b == -1 && dist[a] + 1 == freeJobDist) {
+                    // Augment: flip every edge on the stack path
+                    for (int k = (int)stck.size() - 1; k >= 0; k--) {
+                        int x = stck[k];
+                        int job = G[x][it[x]];
+                        matchJob[job] = x;
+                        matchApplicant[x] = job;
+                    }
+                    for (int x : stck) dist[x] = NIL;   // used in this phase
+                    ans++;
+                    break;
+                }
+                if (b != -1 && dist[b] == dist[a] + 1) {
+                    stck.push_back(b);
+                    continue;
+                }
+                it[a]++;
+            }
+        }
+    }
+    return ans;
+}
 
-    cout << "Max num of G matching with applicants is " << ans;
-}
\ No newline at end of file
+// Random offers: every applicant gets `deg` random jobs
+vector<vector<int> > randomOffers(int n, int deg, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<vector<int> > offers(n);
+    for (auto& row : offers)
+        for (int k = 0; k < deg; k++)
+            row.push_back(rng() % n);
+    return offers;
+}
+
+double timeMs(const function<void()>& fn)
+{
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [nodes for Kuhn vs Hopcroft-Karp] [nodes for Hopcroft-Karp only]
+int main(int argc, char* argv[])
+{
+    init({
+            {1, 2}, // Applicant 0 has {1, 2} job offers
+            {0, 3}, // Applicant 1 has {0, 3} job offers
+            {2},
+            {2, 3},
+            {},
+            {5}
+        });
+
+    cout << "Max num of G matching with applicants is " << kuhn() << endl;
+    vector<int> matchApplicant, matchJob;
+    cout << "Hopcroft-Karp matching size is " << hopcroftKarp(matchApplicant, matchJob) << endl;
+
+    int small = argc > 1 ? atoi(argv[1]) : 20000;
+    int big = argc > 2 ? atoi(argv[2]) : 500000;
+
+    init(randomOffers(small, 3, 1));
+    int k = 0, h = 0;
+    double kuhnMs = timeMs([&] { k = kuhn(); });
+    double hkMs = timeMs([&] { h = hopcroftKarp(matchApplicant, matchJob); });
+    cout << "\n" << small << " applicants / jobs\n";
+    cout << "Kuhn         : " << kuhnMs << " ms, matching " << k << "\n";
+    cout << "Hopcroft-Karp: " << hkMs << " ms, matching " << h << "\n";
+
+    init(randomOffers(big, 3, 2));
+    hkMs = timeMs([&] { h = hopcroftKarp(matchApplicant, matchJob); });
+    cout << "\n" << big << " applicants / jobs\n";
+    cout << "Hopcroft-Karp: " << hkMs << " ms, matching " << h << "\n";
+}
@@ -0,0 +1,517 @@
+/*
+CSR (Compressed Sparse Row) Graph
+Immutable graph stored as two flat arrays instead of unordered_map<int, list<int>>:
+    offsets[u] .. offsets[u+1]   -> range of u's neighbors inside neighbors[]
+    neighbors[]                  -> all adjacency lists glued together (internal ids)
+    weights[]                    -> parallel to neighbors[] (only for weighted graphs)
+
+Vertex ids can be any int (like Graph in graph1.cpp). They are remapped to dense
+internal ids 0..n-1 in first-seen order, idOf[] maps back to the original id.
+
+Build  : O(V + E) using counting sort on source vertex
+Memory : (V+1)*8 + E*4 (+ E*4 for weights) bytes, no per-edge node/pointer
+Visit  : neighbors of u are contiguous -> no hash lookup and no pointer chase per edge
+
+Usage:
+    CSRBuilder b(false);        // same addEdge calls as Graph in graph1.cpp
+    b.addEdge(1, 2); ...
+    CSRGraph g = b.freeze();    // or freeze(graph) to convert an existing Graph
+
+Every traversal of graph2.cpp / graph3.cpp is written below on top of CSRGraph.
+Traversals take and return ORIGINAL vertex ids, except dijkstra() which returns
+a dist array indexed by internal id (use g.index(v) to read it).
+DFS based traversals use an explicit stack so deep graphs don't overflow the call stack.
+Same arrays in a binary file loaded with mmap (no parsing, no copy) -> mmap_graph.cpp
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+// Graph from graph1.cpp (hash of lists), kept here for freeze() and the benchmark
+class Graph {
+private:
+    unordered_map<int, list<int>> adjList;
+    bool directed;
+
+public:
+    Graph(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    void addVertex(int vertex) {
+        if (adjList.find(vertex) == adjList.end()) {
+            adjList[vertex] = list<int>();
+        }
+    }
+
+    void addEdge(int v1, int v2) {
+        addVertex(v1);
+        addVertex(v2);
+        adjList[v1].push_back(v2);
+        if (!directed) {
+            adjList[v2].push_back(v1);
+        }
+    }
+
+    vector<int> getVertices() {
+        vector<int> vertices;
+        for (auto& entry : adjList) {
+            vertices.push_back(entry.first);
+        }
+        return vertices;
+    }
+
+    const list<int>& getNeighbors(int vertex) {
+        static const list<int> empty;
+        auto it = adjList.find(vertex);
+        return it == adjList.end() ? empty : it->second;
+    }
+
+    bool isDirected() {
+        return directed;
+    }
+};
+
+
+class CSRGraph {
+public:
+    vector<long long> offsets;      // size n+1
+    vector<int> neighbors;          // size E (2E for undirected), internal ids
+    vector<int> weights;            // empty if the graph is unweighted
+    vector<int> idOf;               // internal id -> original id
+    unordered_map<int, int> indexOf; // original id -> internal id
+    bool directed = false;
+
+    int numVertices() const { return (int)idOf.size(); }
+    long long numEdges() const { return (long long)neighbors.size(); }   // stored (directed) edges
+    bool isWeighted() const { return !weights.empty(); }
+
+    // Internal id of a vertex, -1 if it is not in the graph
+    int index(int vertex) const {
+        auto it = indexOf.find(vertex);
+        return it == indexOf.end() ? -1 : it->second;
+    }
+
+    int degree(int u) const { return (int)(offsets[u + 1] - offsets[u]); }
+
+    // neighbors of internal id u are [nbrBegin(u), nbrEnd(u))
+    const int* nbrBegin(int u) const { return neighbors.data() + offsets[u]; }
+    const int* nbrEnd(int u) const { return neighbors.data() + offsets[u + 1]; }
+    const int* wtBegin(int u) const { return weights.data() + offsets[u]; }
+};
+
+
+// Mutable stage: records edges, then freeze() packs them into a CSRGraph
+class CSRBuilder {
+private:
+    vector<int> src, dst, wt;
+    vector<int> idOf;
+    unordered_map<int, int> indexOf;
+    bool directed;
+    bool weighted = false;
+
+public:
+    CSRBuilder(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    // Returns internal id of vertex (creates it if needed)
+    int addVertex(int vertex) {
+        auto it = indexOf.find(vertex);
+        if (it != indexOf.end()) return it->second;
+        int id = (int)idOf.size();
+        indexOf[vertex] = id;
+        idOf.push_back(vertex);
+        return id;
+    }
+
+    void addEdge(int v1, int v2) {
+        int a = addVertex(v1), b = addVertex(v2);
+        src.push_back(a);
+        dst.push_back(b);
+        if (weighted) wt.push_back(1);
+    }
+
+    void addEdge(int v1, int v2, int weight) {
+        if (!weighted) {
+            weighted = true;
+            wt.reserve(src.capacity());
+            wt.assign(src.size(), 1);   // earlier unweighted edges get weight 1
+        }
+        int a = addVertex(v1), b = addVertex(v2);
+        src.push_back(a);
+        dst.push_back(b);
+        wt.push_back(weight);
+    }
+
+    // pass weighted = true when the edges will come with weights, so wt is reserved up front too
+    void reserve(size_t edges, bool weighted = false) {
+        src.reserve(edges);
+        dst.reserve(edges);
+        if (weighted || this->weighted) wt.reserve(edges);
+    }
+
+    // Counting sort of edges by source. Neighbors keep insertion order,
+    // same as the list order of Graph in graph1.cpp.
+    // The builder is left empty afterwards.
+    CSRGraph freeze() {
+        CSRGraph g;
+        int n = (int)idOf.size();
+        size_t m = src.size();
+        g.directed = directed;
+
+        g.offsets.assign(n + 1, 0);
+        for (size_t i = 0; i < m; i++) {
+            g.offsets[src[i] + 1]++;
+            if (!directed) g.offsets[dst[i] + 1]++;
+        }
+        for (int u = 0; u < n; u++)
+            g.offsets[u + 1] += g.offsets[u];
+
+        g.neighbors.resize(g.offsets[n]);
+        if (weighted) g.weights.resize(g.offsets[n]);
+
+        vector<long long> pos(g.offsets.begin(), g.offsets.end() - 1);
+        for (size_t i = 0; i < m; i++) {
+            long long p = pos[src[i]]++;
+            g.neighbors[p] = dst[i];
+            if (weighted) g.weights[p] = wt[i];
+            if (!directed) {
+                long long q = pos[dst[i]]++;
+                g.neighbors[q] = src[i];
+                if (weighted) g.weights[q] = wt[i];
+            }
+        }
+
+        g.idOf = move(idOf);
+        g.indexOf = move(indexOf);
+        *this = CSRBuilder(directed);
+        return g;
+    }
+};
+
+// Freeze an existing (mutable) Graph from graph1.cpp into CSR form.
+// Its lists already contain both directions of undirected edges, so they are copied as is.
+CSRGraph freeze(Graph& graph) {
+    CSRGraph g;
+    g.directed = graph.isDirected();
+    g.idOf = graph.getVertices();
+    int n = (int)g.idOf.size();
+    g.indexOf.reserve(n);
+    for (int i = 0; i < n; i++)
+        g.indexOf[g.idOf[i]] = i;
+
+    g.offsets.assign(n + 1, 0);
+    for (int u = 0; u < n; u++)
+        g.offsets[u + 1] = g.offsets[u] + (long long)graph.getNeighbors(g.idOf[u]).size();
+
+    g.neighbors.resize(g.offsets[n]);
+    for (int u = 0; u < n; u++) {
+        long long p = g.offsets[u];
+        for (int v : graph.getNeighbors(g.idOf[u]))
+            g.neighbors[p++] = g.indexOf[v];
+    }
+    return g;
+}
+
+
+
+/*************************** Traversals on CSR *****************************/
+
+// DFS (graph2.cpp #1). Explicit stack of (vertex, next neighbor position),
+// visits vertices in exactly the same order as the recursive version.
+vector<int> dfsTraversal(const CSRGraph& g, int start) {
+    vector<int> order;
+    int s = g.index(start);
+    if (s == -1) return order;
+
+    vector<char> visited(g.numVertices(), 0);
+    vector<pair<int, long long>> stck;
+    visited[s] = 1;
+    order.push_back(start);
+    stck.push_back({s, g.offsets[s]});
+
+    while (!stck.empty()) {
+        int u = stck.back().first;
+        long long& it = stck.back().second;
+        if (it == g.offsets[u + 1]) {
+            stck.pop_back();
+            continue;
+        }
+        int v = g.neighbors[it++];
+        if (!visited[v]) {
+            visited[v] = 1;
+            order.push_back(g.idOf[v]);
+            stck.push_back({v, g.offsets[v]});
+        }
+    }
+    return order;
+}
+
+// BFS (graph2.cpp #2). The queue is a plain vector used as a FIFO.
+vector<int> bfs(const CSRGraph& g, int start) {
+    vector<int> order;
+    int s = g.index(start);
+    if (s == -1) return order;
+
+    vector<char> visited(g.numVertices(), 0);
+    vector<int> q;
+    q.reserve(g.numVertices());
+    visited[s] = 1;
+    q.push_back(s);
+
+    for (size_t head = 0; head < q.size(); head++) {
+        int u = q[head];
+        order.push_back(g.idOf[u]);
+        for (const int* p = g.nbrBegin(u); p != g.nbrEnd(u); p++) {
+            if (!visited[*p]) {
+                visited[*p] = 1;
+                q.push_back(*p);
+            }
+        }
+    }
+    return order;
+}
+
+// Dijkstra (graph2.cpp #3). dist[] is indexed by internal id, INT_MAX = unreachable.
+// Unweighted graphs are treated as weight 1 per edge.
+vector<int> dijkstra(const CSRGraph& g, int src) {
+    int n = g.numVertices();
+    vector<int> dist(n, INT_MAX);
+    int s = g.index(src);
+    if (s == -1) return dist;
+
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq;
+    dist[s] = 0;
+    pq.push({0, s});
+
+    while (!pq.empty()) {
+        int d = pq.top().first;
+        int u = pq.top().second;
+        pq.pop();
+        if (d > dist[u]) continue;
+
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int v = g.neighbors[e];
+            int weight = g.isWeighted() ? g.weights[e] : 1;
+            if (d + weight < dist[v]) {
+                dist[v] = d + weight;
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    return dist;
+}
+
+// Topological sort using DFS (graph2.cpp #4). Reverse post order.
+vector<int> topologicalSort(const CSRGraph& g) {
+    int n = g.numVertices();
+    vector<char> visited(n, 0);
+    vector<int> post;
+    post.reserve(n);
+    vector<pair<int, long long>> stck;
+
+    for (int s = 0; s < n; s++) {
+        if (visited[s]) continue;
+        visited[s] = 1;
+        stck.push_back({s, g.offsets[s]});
+        while (!stck.empty()) {
+            int u = stck.back().first;
+            long long& it = stck.back().second;
+            if (it == g.offsets[u + 1]) {
+                post.push_back(g.idOf[u]);   // all children processed
+                stck.pop_back();
+                continue;
+            }
+            int v = g.neighbors[it++];
+            if (!visited[v]) {
+                visited[v] = 1;
+                stck.push_back({v, g.offsets[v]});
+            }
+        }
+    }
+    reverse(post.begin(), post.end());
+    return post;
+}
+
+// Topological sort using BFS / Kahn's algorithm (graph2.cpp topoSortBFS).
+// Returns {} if the graph has a cycle.
+vector<int> topoSortBFS(const CSRGraph& g) {
+    int n = g.numVertices();
+    vector<int> indegree(n, 0);
+    for (int v : g.neighbors) indegree[v]++;
+
+    vector<int> q;
+    q.reserve(n);
+    for (int i = 0; i < n; i++)
+        if (indegree[i] == 0) q.push_back(i);
+
+    for (size_t head = 0; head < q.size(); head++) {
+        int u = q[head];
+        for (const int* p = g.nbrBegin(u); p != g.nbrEnd(u); p++)
+            if (--indegree[*p] == 0) q.push_back(*p);
+    }
+
+    if ((int)q.size() != n) return {};
+    vector<int> topoOrder(n);
+    for (int i = 0; i < n; i++) topoOrder[i] = g.idOf[q[i]];
+    return topoOrder;
+}
+
+// Cycle detection (graph3.cpp #1).
+// Directed: an edge to a vertex that is still on the stack (GREY) closes a cycle.
+// Undirected: an edge to a visited vertex other than the parent closes a cycle.
+bool isCyclic(const CSRGraph& g) {
+    int n = g.numVertices();
+    enum : char { WHITE, GREY, BLACK };
+    vector<char> color(n, WHITE);
+    vector<int> parent(n, -1);
+    vector<pair<int, long long>> stck;
+
+    for (int s = 0; s < n; s++) {
+        if (color[s] != WHITE) continue;
+        color[s] = GREY;
+        stck.push_back({s, g.offsets[s]});
+        while (!stck.empty()) {
+            int u = stck.back().first;
+            long long& it = stck.back().second;
+            if (it == g.offsets[u + 1]) {
+                color[u] = BLACK;
+                stck.pop_back();
+                continue;
+            }
+            int v = g.neighbors[it++];
+            if (color[v] == WHITE) {
+                color[v] = GREY;
+                parent[v] = u;
+                stck.push_back({v, g.offsets[v]});
+            } else if (g.directed ? color[v] == GREY : v != parent[u]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Connected components (graph3.cpp #2), iterative DFS from every unvisited vertex.
+vector<vector<int>> find_connected_components(const CSRGraph& g) {
+    int n = g.numVertices();
+    vector<char> visited(n, 0);
+    vector<vector<int>> components;
+    vector<int> stck;
+
+    for (int s = 0; s < n; s++) {
+        if (visited[s]) continue;
+        vector<int> component;
+        visited[s] = 1;
+        stck.push_back(s);
+        while (!stck.empty()) {
+            int u = stck.back();
+            stck.pop_back();
+            component.push_back(g.idOf[u]);
+            for (const int* p = g.nbrBegin(u); p != g.nbrEnd(u); p++) {
+                if (!visited[*p]) {
+                    visited[*p] = 1;
+                    stck.push_back(*p);
+                }
+            }
+        }
+        components.push_back(component);
+    }
+    return components;
+}
+
+
+
+/*************************** Benchmark *****************************/
+
+// Same BFS as graph2.cpp, on the hash-of-lists Graph
+vector<int> bfs(Graph& g, int start) {
+    vector<int> order;
+    unordered_set<int> visited;
+    queue<int> q;
+    visited.insert(start);
+    q.push(start);
+    while (!q.empty()) {
+        int vertex = q.front();
+        q.pop();
+        order.push_back(vertex);
+        for (int neighbor : g.getNeighbors(vertex)) {
+            if (visited.find(neighbor) == visited.end()) {
+                visited.insert(neighbor);
+                q.push(neighbor);
+            }
+        }
+    }
+    return order;
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Usage: ./a.out [vertices] [edges]
+int main(int argc, char* argv[]) {
+    // Small example
+    CSRBuilder b(true);
+    b.addEdge(5, 7);
+    b.addEdge(5, 9);
+    b.addEdge(7, 11);
+    b.addEdge(9, 11);
+    b.addEdge(11, 2);
+    CSRGraph small = b.freeze();
+
+    cout << "DFS: ";
+    for (int v : dfsTraversal(small, 5)) cout << v << " ";
+    cout << "\nBFS: ";
+    for (int v : bfs(small, 5)) cout << v << " ";
+    cout << "\nTopological sort (DFS): ";
+    for (int v : topologicalSort(small)) cout << v << " ";
+    cout << "\nTopological sort (Kahn): ";
+    for (int v : topoSortBFS(small)) cout << v << " ";
+    cout << "\nCyclic: " << (isCyclic(small) ? "yes" : "no") << "\n\n";
+
+    // Benchmark: random undirected graph with sparse (non contiguous) vertex ids
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+    long long m = argc > 2 ? atoll(argv[2]) : 2000000;
+    mt19937 rng(42);
+    vector<pair<int, int>> edges(m);
+    for (auto& e : edges)
+        e = {(int)(rng() % n) * 3 + 1, (int)(rng() % n) * 3 + 1};
+
+    auto t = chrono::steady_clock::now();
+    Graph lg(false);
+    for (auto& e : edges) lg.addEdge(e.first, e.second);
+    double buildList = elapsedMs(t);
+
+    t = chrono::steady_clock::now();
+    CSRBuilder builder(false);
+    builder.reserve(m);
+    for (auto& e : edges) builder.addEdge(e.first, e.second);
+    CSRGraph g = builder.freeze();
+    double buildCSR = elapsedMs(t);
+
+    t = chrono::steady_clock::now();
+    CSRGraph frozen = freeze(lg);
+    double freezeMs = elapsedMs(t);
+
+    int start = edges[0].first;
+    t = chrono::steady_clock::now();
+    vector<int> a = bfs(lg, start);
+    double bfsList = elapsedMs(t);
+
+    t = chrono::steady_clock::now();
+    vector<int> c = bfs(g, start);
+    double bfsCSR = elapsedMs(t);
+
+    t = chrono::steady_clock::now();
+    vector<int> d = bfs(frozen, start);
+    double bfsFrozen = elapsedMs(t);
+
+    cout << "Vertices: " << g.numVertices() << ", stored edges: " << g.numEdges() << "\n";
+    cout << "Build   Graph: " << buildList << " ms, CSRBuilder: " << buildCSR
+         << " ms, freeze(Graph): " << freezeMs << " ms\n";
+    cout << "BFS     Graph: " << bfsList << " ms, CSR: " << bfsCSR
+         << " ms, frozen CSR: " << bfsFrozen << " ms\n";
+    cout << "Same BFS order: " << (a == c && a == d ? "yes" : "NO") << "\n";
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <bits/stdc++.h>
+// Stack safe DFS engine (pre/post order callbacks, cycle detection, topo sort) -> iterative_DFS.cpp
 #define LIM 3000
 using namespace std;
 
@@ -4,6 +4,8 @@
  * @brief Multi Source shortest path algorithm. Find shortest paths from all nodes to all other nodes.
  * Logic: dist[i][j] =  min (dist[i][j]],dist[i][k] + dist[k][j])
  * Time complexity: O(V^3)
+ * Cache tiled + AVX2 + multi threaded version for big matrices -> FloydWarshall_blocked.cpp
+ * Sparse graphs (few roads per vertex): Johnson, V parallel Dijkstras -> johnson_apsp.cpp
  * @date 2024-07-28
  */
 
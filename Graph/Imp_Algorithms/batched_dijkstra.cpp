@@ -0,0 +1,322 @@
+/*
+Batched / multi-source Dijkstra - many shortest path queries on one graph
+Ref: https://leetcode.com/problems/minimum-weighted-subgraph-with-the-required-paths/description/
+
+Dijkstra::run() in dijkstra.cpp does min_dist.assign(V, INF) on every call, so a batch of queries pays
+O(V) per query just for the reset, and one query only uses one core.
+
+1. Generation stamped distances (DijkstraWorkspace)
+    -> stamp[v] = generation in which dist[v] was written, a new query only does generation++
+    -> dist[v] is INF whenever stamp[v] != generation, so the reset is O(1)
+    -> the heap storage is also kept, a query allocates nothing once the workspace is warm
+
+2. Multi-source (the "virtual node joined to every source" trick from dijkstra.cpp)
+    -> all sources start in the heap with distance 0, result = distance to the NEAREST source
+       and which source it is (Voronoi cells, nearest hospital, ...)
+
+3. Batches on a thread pool
+    -> fromEach(sources)  : one full distance row per source (the "run 3-4 times" case)
+    -> pairs(queries)     : {source, target} pairs grouped by source, one search per distinct source
+                            that stops as soon as all of its targets are settled
+    -> independent searches are handed to threads through an atomic counter,
+       every thread owns one workspace (no locks inside a search)
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+// Fixed set of worker threads, run(fn) calls fn(threadId) on every thread and waits.
+// The calling thread works as thread 0.
+class ThreadPool {
+private:
+    vector<thread> workers;
+    mutex mtx;
+    condition_variable cvStart, cvDone;
+    function<void(int)> job;
+    long long generation = 0;
+    int pending = 0;
+    bool stop = false;
+
+    void workerLoop(int id) {
+        long long seen = 0;
+        while (true) {
+            unique_lock<mutex> lock(mtx);
+            cvStart.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) return;
+            seen = generation;
+            lock.unlock();
+
+            job(id);
+
+            lock.lock();
+            if (--pending == 0) cvDone.notify_one();
+        }
+    }
+
+public:
+    ThreadPool(int numThreads) {
+        for (int i = 1; i < numThreads; i++)
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stop = true;
+        }
+        cvStart.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    int size() const { return (int)workers.size() + 1; }
+
+    void run(const function<void(int)>& fn) {
+        {
+            lock_guard<mutex> lock(mtx);
+            job = fn;
+            pending = (int)workers.size();
+            generation++;
+        }
+        cvStart.notify_all();
+        fn(0);
+        unique_lock<mutex> lock(mtx);
+        cvDone.wait(lock, [&] { return pending == 0; });
+    }
+};
+
+
+// Per thread state of one search, reset in O(1)
+class DijkstraWorkspace {
+private:
+    vector<int> dist, owner;
+    vector<unsigned> stamp, targetStamp;
+    unsigned generation = 0;
+
+public:
+    vector<pii> heap;           // {dist, vertex} min heap through push_heap / pop_heap
+
+    DijkstraWorkspace(int n) : dist(n), owner(n), stamp(n, 0), targetStamp(n, 0) {}
+
+    void reset() {
+        if (++generation == 0) {        // wrapped around after 2^32 queries
+            fill(stamp.begin(), stamp.end(), 0);
+            fill(targetStamp.begin(), targetStamp.end(), 0);
+            generation = 1;
+        }
+        heap.clear();
+    }
+
+    int get(int v) const { return stamp[v] == generation ? dist[v] : INF; }
+    int source(int v) const { return stamp[v] == generation ? owner[v] : -1; }
+    void set(int v, int d, int src) {
+        stamp[v] = generation;
+        dist[v] = d;
+        owner[v] = src;
+    }
+
+    // returns false if v was already a target in this query
+    bool markTarget(int v) {
+        if (targetStamp[v] == generation) return false;
+        targetStamp[v] = generation;
+        return true;
+    }
+    bool isTarget(int v) const { return targetStamp[v] == generation; }
+};
+
+
+class BatchedDijkstra {
+private:
+    const vector<vector<pii>>& adj;
+    ThreadPool pool;
+    vector<DijkstraWorkspace> ws;       // one per thread
+
+    // Dijkstra from all sources in [first, last) at once (workspace must be reset),
+    // stops after a vertex for which stopAt(v) returns true is settled
+    template <class Stop>
+    void search(DijkstraWorkspace& w, const int* first, const int* last, Stop stopAt) {
+        auto cmp = greater<pii>();
+        for (const int* s = first; s != last; s++)
+            if (w.get(*s) != 0) {
+                w.set(*s, 0, *s);
+                w.heap.push_back({0, *s});
+            }
+        make_heap(w.heap.begin(), w.heap.end(), cmp);
+
+        while (!w.heap.empty()) {
+            pop_heap(w.heap.begin(), w.heap.end(), cmp);
+            auto [curr_dist, curr] = w.heap.back();
+            w.heap.pop_back();
+            if (curr_dist > w.get(curr)) continue;
+            if (stopAt(curr)) return;
+
+            for (auto& e : adj[curr]) {
+                int nd = curr_dist + e.second;
+                if (nd < w.get(e.first)) {
+                    w.set(e.first, nd, w.source(curr));
+                    w.heap.push_back({nd, e.first});
+                    push_heap(w.heap.begin(), w.heap.end(), cmp);
+                }
+            }
+        }
+    }
+
+    // Calls job(threadId, i) for i in [0, count), dynamic scheduling
+    template <class Job>
+    void forEach(size_t count, Job job) {
+        atomic<size_t> next(0);
+        pool.run([&](int tid) {
+            for (size_t i; (i = next.fetch_add(1, memory_order_relaxed)) < count;) job(tid, i);
+        });
+    }
+
+public:
+    BatchedDijkstra(const vector<vector<pii>>& adj, int numThreads)
+        : adj(adj), pool(max(1, numThreads)), ws(max(1, numThreads), DijkstraWorkspace(adj.size())) {}
+
+    // dist[v] = distance to the nearest source, nearest[v] = that source (-1 if unreachable)
+    void multiSource(const vector<int>& sources, vector<int>& dist, vector<int>& nearest) {
+        DijkstraWorkspace& w = ws[0];
+        w.reset();
+        search(w, sources.data(), sources.data() + sources.size(), [](int) { return false; });
+        int n = adj.size();
+        dist.resize(n);
+        nearest.resize(n);
+        for (int v = 0; v < n; v++) {
+            dist[v] = w.get(v);
+            nearest[v] = w.source(v);
+        }
+    }
+
+    // rows[i] = min_dist from sources[i], searches run concurrently
+    vector<vector<int>> fromEach(const vector<int>& sources) {
+        vector<vector<int>> rows(sources.size());
+        forEach(sources.size(), [&](int tid, size_t i) {
+            DijkstraWorkspace& w = ws[tid];
+            w.reset();
+            search(w, &sources[i], &sources[i] + 1, [](int) { return false; });
+            rows[i].resize(adj.size());
+            for (size_t v = 0; v < adj.size(); v++) rows[i][v] = w.get(v);
+        });
+        return rows;
+    }
+
+    // answer[i] = distance from queries[i].first to queries[i].second (INF if unreachable)
+    vector<int> pairs(const vector<pii>& queries) {
+        vector<int> order(queries.size()), answer(queries.size(), INF);
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int a, int b) { return queries[a].first < queries[b].first; });
+        vector<size_t> groupStart;
+        for (size_t i = 0; i < order.size(); i++)
+            if (i == 0 || queries[order[i]].first != queries[order[i - 1]].first) groupStart.push_back(i);
+        groupStart.push_back(order.size());
+
+        forEach(groupStart.size() - 1, [&](int tid, size_t g) {
+            DijkstraWorkspace& w = ws[tid];
+            w.reset();
+            int remaining = 0;
+            for (size_t i = groupStart[g]; i < groupStart[g + 1]; i++)
+                remaining += w.markTarget(queries[order[i]].second);
+            int src = queries[order[groupStart[g]]].first;
+            search(w, &src, &src + 1, [&](int v) { return w.isTarget(v) && --remaining == 0; });
+            for (size_t i = groupStart[g]; i < groupStart[g + 1]; i++)
+                answer[order[i]] = w.get(queries[order[i]].second);
+        });
+        return answer;
+    }
+};
+
+
+/*************************** Benchmark *****************************/
+
+// dijkstra() from dijkstra.cpp (full reset + full run every call)
+vector<int> min_dist;
+void dijkstra(const vector<vector<pii>>& adj, int src) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    min_dist.assign(adj.size(), INF);
+    min_dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        int curr_dist = pq.top().first;
+        int curr = pq.top().second;
+        pq.pop();
+        if (curr_dist > min_dist[curr]) continue;
+        for (auto u : adj[curr])
+            if (min_dist[u.first] > min_dist[curr] + u.second) {
+                min_dist[u.first] = min_dist[curr] + u.second;
+                pq.push({min_dist[u.first], u.first});
+            }
+    }
+}
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [vertices] [edges] [pairs] [threads]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int m = argc > 2 ? atoi(argv[2]) : 400000;
+    int Q = argc > 3 ? atoi(argv[3]) : 1000;
+    int threads = argc > 4 ? atoi(argv[4]) : max(1u, thread::hardware_concurrency());
+
+    mt19937 rng(18);
+    vector<vector<pii>> adj(n);
+    for (int i = 0; i < m; i++) {
+        int u = rng() % n, v = rng() % n, wt = 1 + rng() % 100;
+        adj[u].push_back({v, wt});
+        adj[v].push_back({u, wt});
+    }
+
+    // Pairs: few distinct sources (like "distance from each depot to its customers")
+    int distinctSources = max(1, Q / 20);
+    vector<int> depots(distinctSources);
+    for (auto& d : depots) d = rng() % n;
+    vector<pii> queries(Q);
+    for (auto& q : queries) q = {depots[rng() % distinctSources], (int)(rng() % n)};
+
+    vector<int> expected(Q);
+    int checked = min(Q, 100);
+    double naiveMs = timeMs([&] {
+        for (int i = 0; i < checked; i++) {
+            dijkstra(adj, queries[i].first);
+            expected[i] = min_dist[queries[i].second];
+        }
+    }) * Q / checked;
+
+    cout << "Graph " << n << " vertices, " << m << " edges, " << Q << " pairs from " << distinctSources << " sources\n";
+    cout << "  dijkstra() per pair (estimated from " << checked << "): " << naiveMs << " ms\n";
+    vector<int> threadCounts = {1};
+    if (threads > 1) threadCounts.push_back(threads);
+    for (int T : threadCounts) {
+        BatchedDijkstra batch(adj, T);
+        vector<int> ans;
+        double ms = timeMs([&] { ans = batch.pairs(queries); });
+        bool ok = equal(expected.begin(), expected.begin() + checked, ans.begin());
+        cout << "  Batched pairs, " << T << " thread(s)            : " << ms << " ms" << (ok ? "" : "  WRONG") << "\n";
+    }
+
+    // Multi source: nearest of k sources vs min over k separate runs
+    int k = 8;
+    vector<int> sources(depots.begin(), depots.begin() + min(k, distinctSources));
+    BatchedDijkstra batch(adj, threads);
+    vector<int> dist, nearest;
+    double msMs = timeMs([&] { batch.multiSource(sources, dist, nearest); });
+    vector<vector<int>> rows;
+    double rowsMs = timeMs([&] { rows = batch.fromEach(sources); });
+    bool ok = true;
+    for (int v = 0; v < n; v++) {
+        int best = INF;
+        for (auto& r : rows) best = min(best, r[v]);
+        if (best != dist[v]) ok = false;
+        // the nearest source found must really be at that distance
+        size_t i = find(sources.begin(), sources.end(), nearest[v]) - sources.begin();
+        if (nearest[v] != -1 && rows[i][v] != best) ok = false;
+    }
+    cout << "  Multi-source (" << sources.size() << " sources, one search): " << msMs << " ms" << (ok ? "" : "  WRONG") << "\n";
+    cout << "  fromEach (" << sources.size() << " rows, " << threads << " thread(s))  : " << rowsMs << " ms\n";
+}
@@ -0,0 +1,299 @@
+/*
+    Lock-free concurrent Disjoint Set (makeFriend / isFriend from many threads at once)
+    Ref: Jayanti, Tarjan "A Randomized Concurrent Algorithm for Disjoint Set Union" (PODC 2016)
+    Ref: Anderson, Woll "Wait-free Parallel Algorithms for the Union-Find Problem"
+
+    union_find_algo.cpp uses global parent/sz vectors and a recursive find, it is not safe
+    to call from more than one thread. Here:
+    -> parent[] is one flat array of atomic<int>, no locks anywhere
+    -> find(x)  : path HALVING, parent[x] is swung to its grandparent with a CAS.
+                  If the CAS fails some other thread already changed it, which is fine.
+    -> unite(x,y): find both roots, link the root with LOWER priority under the other one with
+                  CAS(parent[root], root, otherRoot). CAS fails only if root stopped being a root,
+                  then we simply retry from the new roots.
+    -> sameSet(x,y): roots equal -> true. Roots differ and x's root is STILL a root -> false
+                  (at that moment they really were in different sets), otherwise retry.
+    -> priority = hash of the index, a fixed random order so trees stay O(log n) deep
+       in expectation (union by size would need two words to change together).
+
+    Every operation is lock-free: a retry only happens when another thread made progress.
+    Expected time per operation O(log n) worst case, close to O(alpha(n)) in practice.
+*/
+
+#include <bits/stdc++.h>
+
+using namespace std;
+
+class ConcurrentUnionFind
+{
+private:
+    vector<atomic<int>> parent;
+
+    // Fixed random order of the vertices (splitmix64 finalizer)
+    static uint64_t priority(int x)
+    {
+        uint64_t z = (uint64_t)x + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    static bool lower(int a, int b)
+    {
+        uint64_t pa = priority(a), pb = priority(b);
+        return pa < pb || (pa == pb && a < b);
+    }
+
+public:
+    ConcurrentUnionFind(int n) : parent(n)
+    {
+        for (int i = 0; i < n; i++)
+            parent[i].store(i, memory_order_relaxed);
+    }
+
+    int size() const { return (int)parent.size(); }
+
+    int find(int x)
+    {
+        while (true)
+        {
+            int p = parent[x].load(memory_order_acquire);
+            if (p == x)
+                return x;
+            int gp = parent[p].load(memory_order_acquire);
+            if (p != gp) // path halving: x now points to its grandparent
+                parent[x].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+            x = gp;
+        }
+    }
+
+    // Returns true if x and y were in different sets
+    bool unite(int x, int y)
+    {
+        while (true)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+                return false;
+            if (lower(y, x))
+                swap(x, y);
+            // x has lower priority, hang it below y if it is still a root
+            int expected = x;
+            if (parent[x].compare_exchange_strong(expected, y, memory_order_acq_rel))
+                return true;
+        }
+    }
+
+    bool sameSet(int x, int y)
+    {
+        while (true)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+                return true;
+            if (parent[x].load(memory_order_acquire) == x)
+                return false;
+        }
+    }
+};
+
+
+/*************************** Single threaded versions *****************************/
+
+// union_find_algo.cpp
+struct SizeUnionFind
+{
+    vector<int> parent, sz;
+    SizeUnionFind(int n) : parent(n), sz(n, 1) { iota(parent.begin(), parent.end(), 0); }
+    int find(int x)
+    {
+        if (parent[x] == x)
+            return x;
+        return parent[x] = find(parent[x]);
+    }
+    void weightedUnion(int x, int y)
+    {
+        int xRoot = find(x), yRoot = find(y);
+        if (xRoot == yRoot)
+            return;
+        if (sz[xRoot] < sz[yRoot])
+            swap(xRoot, yRoot);
+        parent[yRoot] = xRoot;
+        sz[xRoot] += sz[yRoot];
+    }
+};
+
+// UnionFind from graph2.cpp (two unordered_maps)
+class MapUnionFind
+{
+private:
+    unordered_map<int, int> parent;
+    unordered_map<int, int> rank;
+
+public:
+    MapUnionFind(int n)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            parent[v] = v;
+            rank[v] = 0;
+        }
+    }
+    int find(int item)
+    {
+        if (parent[item] != item)
+            parent[item] = find(parent[item]);
+        return parent[item];
+    }
+    void unionSets(int x, int y)
+    {
+        int rootX = find(x), rootY = find(y);
+        if (rootX != rootY)
+        {
+            if (rank[rootX] < rank[rootY])
+                swap(rootX, rootY);
+            parent[rootY] = rootX;
+            if (rank[rootX] == rank[rootY])
+                rank[rootX]++;
+        }
+    }
+};
+
+
+/*************************** Stress test + benchmark *****************************/
+
+struct Op
+{
+    bool isUnite;
+    int x, y;
+};
+
+vector<Op> makeOps(int n, int m, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<Op> ops(m);
+    for (auto &op : ops)
+        op = {rng() % 4 == 0, (int)(rng() % n), (int)(rng() % n)}; // 25% makeFriend, 75% isFriend
+    return ops;
+}
+
+// Many threads unite and query at the same time, then the final partition must equal the
+// sequential one, and every thread must see its own earlier unions.
+bool stressTest(int n, int threads, int rounds)
+{
+    for (int r = 0; r < rounds; r++)
+    {
+        ConcurrentUnionFind cuf(n);
+        vector<vector<Op>> work(threads);
+        for (int t = 0; t < threads; t++)
+            work[t] = makeOps(n, n, r * 131 + t);
+
+        atomic<bool> ok(true);
+        vector<thread> workers;
+        for (int t = 0; t < threads; t++)
+            workers.emplace_back([&, t] {
+                for (auto &op : work[t])
+                {
+                    if (op.isUnite)
+                    {
+                        cuf.unite(op.x, op.y);
+                        if (!cuf.sameSet(op.y, op.x))
+                            ok = false;
+                    }
+                    else
+                        cuf.sameSet(op.x, op.y);
+                }
+            });
+        for (auto &w : workers)
+            w.join();
+
+        SizeUnionFind seq(n);
+        for (auto &ops : work)
+            for (auto &op : ops)
+                if (op.isUnite)
+                    seq.weightedUnion(op.x, op.y);
+        for (int i = 0; i < n && ok; i++)
+        {
+            int j = (i * 7919) % n;
+            if ((seq.find(i) == seq.find(j)) != cuf.sameSet(i, j) ||
+                (seq.find(i) == seq.find(0)) != cuf.sameSet(i, 0))
+                ok = false;
+        }
+        if (!ok)
+            return false;
+    }
+    return true;
+}
+
+template <class F>
+double opsPerSec(long long ops, F fn)
+{
+    auto t = chrono::steady_clock::now();
+    fn();
+    double sec = chrono::duration<double>(chrono::steady_clock::now() - t).count();
+    return ops / sec;
+}
+
+// Usage: ./a.out [friends] [operations] [max threads]
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int m = argc > 2 ? atoi(argv[2]) : 10000000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : max(2u, thread::hardware_concurrency());
+
+    cout << "Stress test (" << maxThreads << " threads): "
+         << (stressTest(20000, maxThreads, 20) ? "passed" : "FAILED") << "\n\n";
+
+    vector<Op> ops = makeOps(n, m, 1);
+    long long answer = 0;
+    cout << fixed << setprecision(2);
+
+    double mapRate = opsPerSec(m, [&] {
+        MapUnionFind uf(n);
+        for (auto &op : ops)
+            if (op.isUnite)
+                uf.unionSets(op.x, op.y);
+            else
+                answer += uf.find(op.x) == uf.find(op.y);
+    });
+    cout << "graph2.cpp UnionFind (unordered_map): " << mapRate / 1e6 << " M ops/s\n";
+
+    double seqRate = opsPerSec(m, [&] {
+        SizeUnionFind uf(n);
+        for (auto &op : ops)
+            if (op.isUnite)
+                uf.weightedUnion(op.x, op.y);
+            else
+                answer += uf.find(op.x) == uf.find(op.y);
+    });
+    cout << "union_find_algo.cpp (vectors)       : " << seqRate / 1e6 << " M ops/s\n";
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+    for (int threads : threadCounts)
+    {
+        ConcurrentUnionFind uf(n);
+        atomic<long long> sameCount(0);
+        double rate = opsPerSec(m, [&] {
+            vector<thread> workers;
+            for (int t = 0; t < threads; t++)
+                workers.emplace_back([&, t] {
+                    long long local = 0;
+                    for (size_t i = t; i < ops.size(); i += threads)
+                        if (ops[i].isUnite)
+                            uf.unite(ops[i].x, ops[i].y);
+                        else
+                            local += uf.sameSet(ops[i].x, ops[i].y);
+                    sameCount += local;
+                });
+            for (auto &w : workers)
+                w.join();
+        });
+        cout << "Lock-free, " << threads << " thread(s)              : " << rate / 1e6 << " M ops/s\n";
+    }
+    return answer < 0;
+}
@@ -0,0 +1,451 @@
+/*
+Contraction Hierarchies (CH) - many point to point queries on a static weighted graph
+Ref: Geisberger, Sanders, Schultes, Delling "Contraction Hierarchies: Faster and Simpler
+     Hierarchical Routing in Road Networks" (WEA 2008)
+
+Running dijkstra() (dijkstra.cpp) per query settles the whole graph, even point_to_point.cpp
+settles thousands of vertices per query on a big grid. CH moves the work to a one time preprocessing.
+
+Preprocessing
+    -> Contract vertices one by one in order of "importance" (least important first).
+       Contracting v: for every pair of remaining neighbors u, w, if u - v - w may be the ONLY
+       shortest path between u and w, add a shortcut edge u - w (weight wt(u,v) + wt(v,w), middle = v).
+       A "witness search" (small Dijkstra from u that avoids v) proves a shortcut unnecessary.
+    -> Importance = 2 * edge difference (shortcuts added - edges removed) + contracted neighbors
+       + level (depth of the hierarchy below v), kept in a heap with lazy updates (recomputed when popped)
+    -> rank[v] = position in the contraction order
+    -> Index = for every v only the edges to HIGHER ranked vertices (upward graph), CSR layout
+
+Query (s, t)
+    -> Dijkstra from s and from t, both only go UP in rank
+    -> Every shortest path has a highest vertex, both searches reach it -> best = min d_s(x) + d_t(x)
+    -> A side stops when its heap top >= best
+    -> Stall on demand: skip u if a higher neighbor already reaches it cheaper (graph is undirected,
+       so the edges from higher neighbors down to u are exactly u's upward edges)
+    -> Shortcuts are unpacked back into original edges through their middle vertex
+
+The graph is undirected (like addEdge in dijkstra.cpp), so one upward graph serves both searches.
+The index can be saved to / loaded from a binary file so the preprocessing runs once.
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+struct CHEdge {
+    int to, wt, middle;     // middle = -1 for an original edge
+};
+
+struct CHIndex {
+    int n = 0;
+    vector<int> rank;
+    vector<long long> offsets;  // edges[offsets[v] .. offsets[v+1]) go from v to higher ranked vertices
+    vector<CHEdge> edges;
+
+    bool save(const string& file) const {
+        ofstream out(file, ios::binary);
+        const char magic[4] = {'C', 'H', 'I', '2'};
+        long long m = edges.size();
+        out.write(magic, 4);
+        out.write((const char*)&n, sizeof(n));
+        out.write((const char*)&m, sizeof(m));
+        out.write((const char*)rank.data(), n * sizeof(int));
+        out.write((const char*)offsets.data(), (n + 1) * sizeof(long long));
+        out.write((const char*)edges.data(), m * sizeof(CHEdge));
+        return (bool)out;
+    }
+
+    // false (and the index left empty) for a truncated, foreign or corrupt file
+    bool load(const string& file) {
+        ifstream in(file, ios::binary | ios::ate);
+        long long bytes = in.tellg();
+        in.seekg(0);
+        char magic[4];
+        long long m;
+        *this = CHIndex();
+        if (!in.read(magic, 4) || memcmp(magic, "CHI2", 4) != 0) return false;
+        if (!in.read((char*)&n, sizeof(n)) || !in.read((char*)&m, sizeof(m))) return false;
+        // sizes must match the file before anything is allocated
+        long long header = 4 + sizeof(n) + sizeof(m);
+        if (n < 0 || m < 0 || m > (bytes - header) / (long long)sizeof(CHEdge) ||
+            header + n * (long long)sizeof(int) + (n + 1LL) * (long long)sizeof(long long) + m * (long long)sizeof(CHEdge) != bytes) {
+            n = 0;
+            return false;
+        }
+
+        rank.resize(n);
+        offsets.resize(n + 1);
+        edges.resize(m);
+        in.read((char*)rank.data(), n * sizeof(int));
+        in.read((char*)offsets.data(), (n + 1) * sizeof(long long));
+        in.read((char*)edges.data(), m * sizeof(CHEdge));
+
+        bool ok = (bool)in && offsets[0] == 0 && offsets[n] == m;
+        for (int v = 0; v < n && ok; v++) ok = offsets[v] <= offsets[v + 1] && rank[v] >= 0 && rank[v] < n;
+        for (long long k = 0; k < m && ok; k++)
+            ok = edges[k].to >= 0 && edges[k].to < n && edges[k].middle >= -1 && edges[k].middle < n;
+        if (!ok) *this = CHIndex();
+        return ok;
+    }
+};
+
+
+class CHBuilder {
+private:
+    int n;
+    vector<vector<CHEdge>> g;               // current graph, contracted neighbors are skipped
+    vector<char> contracted;
+    vector<int> contractedNeighbors, level;    // level = depth in the hierarchy so far
+    // witness search workspace
+    vector<int> dist, targetStamp;
+    vector<int> touched;
+    int stamp = 0;
+    static const int WITNESS_SETTLE_LIMIT = 200;
+
+    // Dijkstra from u in the remaining graph without `skip`. Stops when all `targets` vertices
+    // (marked with the current stamp) are settled, at maxDist or at the settle limit
+    void witnessSearch(int u, int skip, int maxDist, int targets) {
+        for (int v : touched) dist[v] = INF;
+        touched.clear();
+        priority_queue<pii, vector<pii>, greater<pii>> pq;
+        dist[u] = 0;
+        touched.push_back(u);
+        pq.push({0, u});
+        int settled = 0;
+        while (!pq.empty()) {
+            auto [d, x] = pq.top();
+            pq.pop();
+            if (d > dist[x]) continue;
+            if (d > maxDist || ++settled > WITNESS_SETTLE_LIMIT) break;
+            if (targetStamp[x] == stamp && --targets == 0) break;
+            for (auto& e : g[x]) {
+                if (contracted[e.to] || e.to == skip) continue;
+                if (d + e.wt < dist[e.to]) {
+                    if (dist[e.to] == INF) touched.push_back(e.to);
+                    dist[e.to] = d + e.wt;
+                    pq.push({dist[e.to], e.to});
+                }
+            }
+        }
+    }
+
+    // Remaining neighbors of v with the lightest edge to each
+    vector<CHEdge> neighbors(int v) {
+        vector<CHEdge> out;
+        for (auto& e : g[v])
+            if (!contracted[e.to]) out.push_back(e);
+        sort(out.begin(), out.end(), [](const CHEdge& a, const CHEdge& b) { return a.to != b.to ? a.to < b.to : a.wt < b.wt; });
+        out.erase(unique(out.begin(), out.end(), [](const CHEdge& a, const CHEdge& b) { return a.to == b.to; }), out.end());
+        return out;
+    }
+
+    // Shortcuts {u, w, wt} needed if v is contracted now
+    vector<array<int, 3>> shortcuts(int v, const vector<CHEdge>& nb) {
+        vector<array<int, 3>> out;
+        int maxOut = 0;
+        for (auto& e : nb) maxOut = max(maxOut, e.wt);
+        for (size_t i = 0; i + 1 < nb.size(); i++) {
+            stamp++;
+            for (size_t j = i + 1; j < nb.size(); j++) targetStamp[nb[j].to] = stamp;
+            witnessSearch(nb[i].to, v, nb[i].wt + maxOut, nb.size() - i - 1);
+            for (size_t j = i + 1; j < nb.size(); j++) {
+                int via = nb[i].wt + nb[j].wt;
+                if (dist[nb[j].to] > via) out.push_back({nb[i].to, nb[j].to, via});
+            }
+        }
+        return out;
+    }
+
+    int priority(int v) {
+        vector<CHEdge> nb = neighbors(v);
+        return 2 * ((int)shortcuts(v, nb).size() - (int)nb.size()) + contractedNeighbors[v] + level[v];
+    }
+
+    void addOrImprove(int u, int w, int wt, int middle) {
+        for (auto& e : g[u])
+            if (e.to == w) {
+                if (wt < e.wt) e = {w, wt, middle};
+                return;
+            }
+        g[u].push_back({w, wt, middle});
+    }
+
+public:
+    // adj[u] = {v, wt}, undirected: both directions present
+    CHBuilder(const vector<vector<pii>>& adj)
+        : n(adj.size()), g(adj.size()), contracted(adj.size(), 0), contractedNeighbors(adj.size(), 0),
+          level(adj.size(), 0), dist(adj.size(), INF), targetStamp(adj.size(), 0) {
+        for (int u = 0; u < n; u++)
+            for (auto& e : adj[u])
+                if (e.first != u) g[u].push_back({e.first, e.second, -1});
+    }
+
+    CHIndex build(long long& shortcutCount) {
+        CHIndex idx;
+        idx.n = n;
+        idx.rank.assign(n, 0);
+        vector<vector<CHEdge>> up(n);
+        shortcutCount = 0;
+
+        priority_queue<pii, vector<pii>, greater<pii>> pq;     // {priority, vertex}
+        for (int v = 0; v < n; v++) pq.push({priority(v), v});
+
+        for (int order = 0; !pq.empty();) {
+            int v = pq.top().second;
+            pq.pop();
+            if (contracted[v]) continue;
+            // lazy update: contract only if still the minimum
+            int p = priority(v);
+            if (!pq.empty() && p > pq.top().first) {
+                pq.push({p, v});
+                continue;
+            }
+
+            vector<CHEdge> nb = neighbors(v);
+            for (auto& sc : shortcuts(v, nb)) {
+                addOrImprove(sc[0], sc[1], sc[2], v);
+                addOrImprove(sc[1], sc[0], sc[2], v);
+                shortcutCount++;
+            }
+            up[v] = nb;                         // remaining neighbors are all ranked higher
+            contracted[v] = 1;
+            idx.rank[v] = order++;
+            for (auto& e : nb) {
+                contractedNeighbors[e.to]++;
+                level[e.to] = max(level[e.to], level[v] + 1);
+                auto& l = g[e.to];
+                l.erase(remove_if(l.begin(), l.end(), [&](const CHEdge& x) { return x.to == v; }), l.end());
+            }
+            vector<CHEdge>().swap(g[v]);
+        }
+
+        idx.offsets.assign(n + 1, 0);
+        for (int v = 0; v < n; v++) idx.offsets[v + 1] = idx.offsets[v] + up[v].size();
+        idx.edges.reserve(idx.offsets[n]);
+        for (int v = 0; v < n; v++) idx.edges.insert(idx.edges.end(), up[v].begin(), up[v].end());
+        return idx;
+    }
+};
+
+
+class CHQuery {
+private:
+    const CHIndex& idx;
+    vector<int> dist[2];
+    vector<pii> parent[2];          // {previous vertex, middle of the edge used}
+    vector<int> touched[2];
+
+    // middle of the upward edge between a and b (lower ranked one stores it)
+    int middleOf(int a, int b) const {
+        if (idx.rank[a] > idx.rank[b]) swap(a, b);
+        int best = INF, middle = -1;
+        for (long long k = idx.offsets[a]; k < idx.offsets[a + 1]; k++)
+            if (idx.edges[k].to == b && idx.edges[k].wt < best) {
+                best = idx.edges[k].wt;
+                middle = idx.edges[k].middle;
+            }
+        return middle;
+    }
+
+    // original vertices strictly between a and b
+    void unpack(int a, int b, int middle, vector<int>& out) const {
+        if (middle == -1) return;
+        unpack(a, middle, middleOf(a, middle), out);
+        out.push_back(middle);
+        unpack(middle, b, middleOf(middle, b), out);
+    }
+
+    // side's search path from its source to x, in order, with shortcuts unpacked
+    vector<int> halfPath(int side, int x) const {
+        vector<int> out = {x};
+        for (int v = x; parent[side][v].first != -1; v = parent[side][v].first) {
+            vector<int> inner;
+            unpack(parent[side][v].first, v, parent[side][v].second, inner);
+            out.insert(out.end(), inner.rbegin(), inner.rend());
+            out.push_back(parent[side][v].first);
+        }
+        reverse(out.begin(), out.end());
+        return out;
+    }
+
+public:
+    int settled = 0;
+
+    CHQuery(const CHIndex& idx) : idx(idx) {
+        for (int side = 0; side < 2; side++) {
+            dist[side].assign(idx.n, INF);
+            parent[side].assign(idx.n, {-1, -1});
+        }
+    }
+
+    // distance from s to t (INF if unreachable), path = original vertices s .. t
+    int query(int s, int t, vector<int>* path = nullptr) {
+        priority_queue<pii, vector<pii>, greater<pii>> pq[2];
+        int src[2] = {s, t};
+        for (int side = 0; side < 2; side++) {
+            dist[side][src[side]] = 0;
+            touched[side].push_back(src[side]);
+            pq[side].push({0, src[side]});
+        }
+        int best = INF, meet = -1;
+        settled = 0;
+
+        while (!pq[0].empty() || !pq[1].empty()) {
+            for (int side = 0; side < 2; side++) {
+                if (pq[side].empty()) continue;
+                auto [d, u] = pq[side].top();
+                pq[side].pop();
+                if (d >= best) {
+                    while (!pq[side].empty()) pq[side].pop();      // this side can't improve best
+                    continue;
+                }
+                if (d > dist[side][u]) continue;
+                settled++;
+                // stall on demand: a higher vertex already gives u a shorter distance,
+                // so u is not on a shortest up path and its edges are not relaxed
+                bool stalled = false;
+                for (long long k = idx.offsets[u]; k < idx.offsets[u + 1] && !stalled; k++)
+                    stalled = dist[side][idx.edges[k].to] != INF && dist[side][idx.edges[k].to] + idx.edges[k].wt < d;
+                if (stalled) continue;
+                if (dist[1 - side][u] != INF && d + dist[1 - side][u] < best) {
+                    best = d + dist[1 - side][u];
+                    meet = u;
+                }
+                for (long long k = idx.offsets[u]; k < idx.offsets[u + 1]; k++) {
+                    const CHEdge& e = idx.edges[k];
+                    if (d + e.wt < dist[side][e.to]) {
+                        if (dist[side][e.to] == INF) touched[side].push_back(e.to);
+                        dist[side][e.to] = d + e.wt;
+                        parent[side][e.to] = {u, e.middle};
+                        pq[side].push({dist[side][e.to], e.to});
+                    }
+                }
+            }
+        }
+
+        if (path) {
+            path->clear();
+            if (meet != -1) {
+                *path = halfPath(0, meet);
+                vector<int> back = halfPath(1, meet);
+                path->insert(path->end(), back.rbegin() + 1, back.rend());
+            }
+        }
+        for (int side = 0; side < 2; side++) {
+            for (int v : touched[side]) {
+                dist[side][v] = INF;
+                parent[side][v] = {-1, -1};
+            }
+            touched[side].clear();
+        }
+        return best;
+    }
+};
+
+
+/*************************** Benchmark *****************************/
+
+// dijkstra() from dijkstra.cpp
+vector<int> dijkstra(const vector<vector<pii>>& adj, int src) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<int> min_dist(adj.size(), INF);
+    min_dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        int curr_dist = pq.top().first;
+        int curr = pq.top().second;
+        pq.pop();
+        if (curr_dist > min_dist[curr]) continue;
+        for (auto u : adj[curr])
+            if (min_dist[u.first] > min_dist[curr] + u.second) {
+                min_dist[u.first] = min_dist[curr] + u.second;
+                pq.push({min_dist[u.first], u.first});
+            }
+    }
+    return min_dist;
+}
+
+long long pathLength(const vector<vector<pii>>& adj, const vector<int>& path) {
+    long long len = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        int best = INF;
+        for (auto& e : adj[path[i]])
+            if (e.first == path[i + 1]) best = min(best, e.second);
+        if (best == INF) return INF;
+        len += best;
+    }
+    return len;
+}
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [grid side] [queries] [index file]
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 200;
+    int Q = argc > 2 ? atoi(argv[2]) : 10000;
+    string file = argc > 3 ? argv[3] : "grid.ch";
+    int n = side * side;
+
+    // Road like grid: random weights, some diagonal "highways" are cheaper per length
+    mt19937 rng(17);
+    vector<vector<pii>> adj(n);
+    auto addEdge = [&](int u, int v, int wt) {
+        adj[u].push_back({v, wt});
+        adj[v].push_back({u, wt});
+    };
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) addEdge(u, u + 1, 10 + rng() % 20);
+            if (r + 1 < side) addEdge(u, u + side, 10 + rng() % 20);
+            if (r + 1 < side && c + 1 < side && rng() % 8 == 0) addEdge(u, u + side + 1, 12 + rng() % 6);
+        }
+
+    long long shortcuts = 0;
+    CHIndex built;
+    double buildMs = timeMs([&] { built = CHBuilder(adj).build(shortcuts); });
+    built.save(file);
+    CHIndex idx;
+    double loadMs = timeMs([&] { idx.load(file); });
+
+    cout << side << "x" << side << " grid: " << n << " vertices\n";
+    cout << "  Preprocessing: " << buildMs << " ms, " << shortcuts << " shortcuts, index "
+         << (idx.edges.size() * sizeof(CHEdge) + idx.rank.size() * 2 * sizeof(int)) / 1024 << " KB\n";
+    cout << "  Index load   : " << loadMs << " ms (" << file << ")\n";
+
+    vector<pii> queries(Q);
+    for (auto& q : queries) q = {(int)(rng() % n), (int)(rng() % n)};
+
+    // Correctness (with paths) on a few queries against dijkstra
+    CHQuery ch(idx);
+    bool ok = true;
+    int checks = min(Q, 50);
+    double dijMs = timeMs([&] {
+        for (int i = 0; i < checks; i++) {
+            int expected = dijkstra(adj, queries[i].first)[queries[i].second];
+            vector<int> path;
+            int d = ch.query(queries[i].first, queries[i].second, &path);
+            if (d != expected || pathLength(adj, path) != d || path.front() != queries[i].first ||
+                path.back() != queries[i].second)
+                ok = false;
+        }
+    });
+
+    long long settled = 0, sum = 0;
+    double chMs = timeMs([&] {
+        for (auto& q : queries) {
+            sum += ch.query(q.first, q.second);
+            settled += ch.settled;
+        }
+    });
+    cout << "  Dijkstra per query: " << dijMs / checks << " ms (" << checks << " queries + CH check)\n";
+    cout << "  CH query          : " << chMs * 1000 / Q << " us, " << settled / Q << " settled"
+         << (ok ? "" : "  WRONG") << "\n";
+    remove(file.c_str());
+}
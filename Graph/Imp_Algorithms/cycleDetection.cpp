@@ -4,6 +4,7 @@
  * @date 2024-07-27
  * 
  * Detect cycle in directed and adirected graphs
+ * Parallel level-by-level Kahn that also returns the cyclic part -> parallel_topological_sort.cpp
  */
 
 #include<bits/stdc++.h>
@@ -0,0 +1,271 @@
+/*
+Delta Stepping - parallel Single Source Shortest Path (Meyer & Sanders)
+Reference -> https://www.sciencedirect.com/science/article/pii/S0196677403000762
+Same answer as dijkstra() in dijkstra.cpp (non-negative weights, INF = unreachable),
+but the work of one query is shared between threads.
+
+Idea:
+    -> Vertices are kept in buckets, bucket i holds tentative distances in [i*delta, (i+1)*delta)
+    -> Take the smallest non-empty bucket and relax all its vertices TOGETHER (in parallel)
+    -> Light edges (wt <= delta) can put vertices back in the same bucket, so repeat until it stays empty
+    -> Heavy edges (wt > delta) can never land in the current bucket, relax them once at the end
+
+    delta = 1       -> behaves like Dial's algorithm (bucket per distance, very little parallel work)
+    delta = INF     -> behaves like parallel Bellman-Ford (lots of parallel work, many re-relaxations)
+    Good choice is around  max weight / average degree  (road networks: a few times the average weight).
+
+Buckets are cyclic: a queued vertex is at most maxWeight above the current bucket, so
+maxWeight / delta + 2 buckets reused round robin are enough (memory does not grow with d / delta).
+
+Distances are updated with an atomic compare-and-swap "min", each thread collects
+the vertices it improved and they are put into buckets after the step.
+Since every vertex ends at its exact shortest distance the result is bit-identical to Dijkstra.
+
+Complexity: O(V + E + d/delta * L) per query where d = max distance, L = max light path length
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+// Fixed set of worker threads, run(fn) calls fn(threadId) on every thread and waits.
+// The calling thread works as thread 0.
+class ThreadPool {
+private:
+    vector<thread> workers;
+    mutex mtx;
+    condition_variable cvStart, cvDone;
+    function<void(int)> job;
+    long long generation = 0;
+    int pending = 0;
+    bool stop = false;
+
+    void workerLoop(int id) {
+        long long seen = 0;
+        while (true) {
+            unique_lock<mutex> lock(mtx);
+            cvStart.wait(lock, [&] { return stop || generation != seen; });
+            if (stop) return;
+            seen = generation;
+            lock.unlock();
+
+            job(id);
+
+            lock.lock();
+            if (--pending == 0) cvDone.notify_one();
+        }
+    }
+
+public:
+    ThreadPool(int numThreads) {
+        for (int i = 1; i < numThreads; i++)
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stop = true;
+        }
+        cvStart.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    int size() const { return (int)workers.size() + 1; }
+
+    void run(const function<void(int)>& fn) {
+        {
+            lock_guard<mutex> lock(mtx);
+            job = fn;
+            pending = (int)workers.size();
+            generation++;
+        }
+        cvStart.notify_all();
+        fn(0);
+        unique_lock<mutex> lock(mtx);
+        cvDone.wait(lock, [&] { return pending == 0; });
+    }
+};
+
+
+class DeltaStepping {
+private:
+    int n;
+    int delta, maxWeight = 0;
+    vector<vector<pii>> light, heavy;   // {vertex, weight}
+
+public:
+    // adj[u] = list of {v, wt} (same format as dijkstra.cpp)
+    DeltaStepping(const vector<vector<pii>>& adj, int delta) {
+        n = (int)adj.size();
+        this->delta = max(1, delta);
+        light.resize(n);
+        heavy.resize(n);
+        for (int u = 0; u < n; u++)
+            for (auto& e : adj[u]) {
+                (e.second <= this->delta ? light[u] : heavy[u]).push_back(e);
+                maxWeight = max(maxWeight, e.second);
+            }
+    }
+
+    vector<int> run(int src, ThreadPool& pool) {
+        int T = pool.size();
+        vector<atomic<int>> dist(n);
+        for (auto& d : dist) d.store(INF, memory_order_relaxed);
+
+        // bucket i lives in slot i % numBuckets, queued counts entries (stale ones too)
+        int numBuckets = maxWeight / delta + 2;
+        vector<vector<int>> buckets(numBuckets);
+        size_t queued = 0;
+        vector<vector<int>> improved(T);    // per thread: vertices whose dist went down
+        vector<int> inFrontier(n, -1), inSettled(n, -1);
+        vector<int> frontier, settled;
+        int stamp = 0;
+
+        auto bucketOf = [&](int d) { return d / delta; };
+        auto addToBucket = [&](int v) {
+            buckets[bucketOf(dist[v].load(memory_order_relaxed)) % numBuckets].push_back(v);
+            queued++;
+        };
+
+        // Relax every edge in edges(u) for u in `from`, in parallel
+        auto relax = [&](const vector<int>& from, const vector<vector<pii>>& edges) {
+            pool.run([&](int t) {
+                vector<int>& out = improved[t];
+                for (size_t i = t; i < from.size(); i += T) {
+                    int u = from[i];
+                    int du = dist[u].load(memory_order_relaxed);
+                    for (auto& e : edges[u]) {
+                        int v = e.first, nd = du + e.second;
+                        int old = dist[v].load(memory_order_relaxed);
+                        while (nd < old && !dist[v].compare_exchange_weak(old, nd, memory_order_relaxed));
+                        if (nd < old) out.push_back(v);
+                    }
+                }
+            });
+            for (auto& out : improved) {
+                for (int v : out) addToBucket(v);
+                out.clear();
+            }
+        };
+
+        dist[src].store(0);
+        addToBucket(src);
+
+        for (int i = 0; queued > 0; i++) {
+            vector<int>& bucket = buckets[i % numBuckets];
+            if (bucket.empty()) continue;
+            settled.clear();
+            int bucketStamp = stamp;
+            while (!bucket.empty()) {
+                // Take the current bucket, drop stale and duplicate entries
+                stamp++;
+                frontier.clear();
+                vector<int> current;
+                current.swap(bucket);
+                queued -= current.size();
+                for (int v : current) {
+                    if (bucketOf(dist[v].load(memory_order_relaxed)) != i || inFrontier[v] == stamp)
+                        continue;
+                    inFrontier[v] = stamp;
+                    frontier.push_back(v);
+                    if (inSettled[v] <= bucketStamp) {
+                        inSettled[v] = stamp;
+                        settled.push_back(v);
+                    }
+                }
+                relax(frontier, light);
+            }
+            // Distances in bucket i are final now
+            relax(settled, heavy);
+        }
+
+        vector<int> result(n);
+        for (int v = 0; v < n; v++) result[v] = dist[v].load(memory_order_relaxed);
+        return result;
+    }
+};
+
+
+// Same dijkstra as dijkstra.cpp, used as reference
+vector<int> dijkstra(const vector<vector<pii>>& adj, int src) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<int> min_dist(adj.size(), INF);
+
+    min_dist[src] = 0;
+    pq.push({0, src});
+
+    while (!pq.empty()) {
+        int curr_dist = pq.top().first;
+        int curr = pq.top().second;
+        pq.pop();
+
+        if (curr_dist > min_dist[curr])
+            continue;
+
+        for (auto u : adj[curr]) {
+            int next = u.first;
+            int weight = u.second;
+
+            if (min_dist[next] > min_dist[curr] + weight) {
+                min_dist[next] = min_dist[curr] + weight;
+                pq.push({min_dist[next], next});
+            }
+        }
+    }
+    return min_dist;
+}
+
+// Road network like graph: rows x cols grid with random weights plus a few long "highways"
+vector<vector<pii>> makeGrid(int rows, int cols, mt19937& rng) {
+    int n = rows * cols;
+    vector<vector<pii>> adj(n);
+    auto addEdge = [&](int u, int v, int wt) {
+        adj[u].push_back({v, wt});
+        adj[v].push_back({u, wt});
+    };
+    for (int r = 0; r < rows; r++)
+        for (int c = 0; c < cols; c++) {
+            int u = r * cols + c;
+            if (c + 1 < cols) addEdge(u, u + 1, 1 + rng() % 100);
+            if (r + 1 < rows) addEdge(u, u + cols, 1 + rng() % 100);
+        }
+    for (int i = 0; i < n / 100; i++)
+        addEdge(rng() % n, rng() % n, 500 + rng() % 1000);
+    return adj;
+}
+
+// Usage: ./a.out [grid side] [max threads]
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 1000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+
+    mt19937 rng(1);
+    vector<vector<pii>> adj = makeGrid(side, side, rng);
+    int src = 0;
+
+    auto t = chrono::steady_clock::now();
+    vector<int> expected = dijkstra(adj, src);
+    double dijkstraMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+    cout << "Vertices: " << adj.size() << "\n";
+    cout << "Dijkstra: " << dijkstraMs << " ms\n";
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (int delta : {10, 50, 200, 1000}) {
+        DeltaStepping ds(adj, delta);
+        for (int threads : threadCounts) {
+            ThreadPool pool(threads);
+            t = chrono::steady_clock::now();
+            vector<int> dist = ds.run(src, pool);
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+            cout << "Delta stepping, delta " << delta << ", " << threads << " thread(s): " << ms << " ms"
+                 << (dist == expected ? "" : "  DIFFERENT FROM DIJKSTRA") << "\n";
+        }
+    }
+    return 0;
+}
@@ -10,50 +10,74 @@ Slight modification: Think of adding a virtual node which joins an edge to each
 
 Dikjtras can be applied 3-4 times... you reverse graph... node a to src and dest dist
 https://leetcode.com/problems/minimum-weighted-subgraph-with-the-required-paths/description/
+
+Parallel version for big graphs (same min_dist output) -> delta_stepping.cpp
+Decrease-key version (d-ary / radix heap, heap size O(V)) -> indexed_heap.cpp
+Only one target (early exit, bidirectional, A* / landmarks) -> point_to_point.cpp
+Millions of queries on a static graph (preprocessing + tiny queries) -> contraction_hierarchies.cpp
+Many sources / many source-target pairs without the O(V) reset per run -> batched_dijkstra.cpp
+Reading a huge edge list file (parallel parsing straight into CSR) -> parallel_edge_ingest.cpp
 */
 #include <bits/stdc++.h>
 using namespace std;
 
-const int LIM = 3000;
 const int INF = 1e9;
 
 typedef pair<int, int> pii;
 
-vector<pii> adj[LIM];
-vector<int> min_dist(LIM, INF);
-
 // Each node in adj list represents vertex and weight
-void addEdge(int u, int v, int wt) {
+void addEdge(vector<vector<pii>>& adj, int u, int v, int wt) {
     adj[u].push_back({v, wt});
     adj[v].push_back({u, wt}); // Remove this line if graph is directed
 }
 
-void dijkstra(int src) {
-    priority_queue<pii, vector<pii>, greater<pii>> pq;
-    min_dist.assign(LIM, INF);
-
-    min_dist[src] = 0;
-    pq.push({0, src});
-
-    while (!pq.empty()) {
-        int curr_dist = pq.top().first;
-        int curr = pq.top().second;
-        pq.pop();
-
-        if (curr_dist > min_dist[curr])
-            continue;
-
-        for (auto u : adj[curr]) {
-            int next = u.first;
-            int weight = u.second;
-
-            if (min_dist[next] > min_dist[curr] + weight) {
-                min_dist[next] = min_dist[curr] + weight;
-                pq.push({min_dist[next], next});
+// min_dist and the heap live in the caller's Workspace (one per thread, reused between queries)
+class Dijkstra {
+private:
+    const vector<vector<pii>>& adj;
+
+public:
+    struct Workspace {
+        vector<int> min_dist;
+        vector<pii> heap;       // min heap of {dist, node} (push_heap / pop_heap), storage kept between calls
+    };
+
+    Dijkstra(const vector<vector<pii>>& adj) : adj(adj) {}
+
+    // returns ws.min_dist (INF = unreachable)
+    const vector<int>& run(int src, Workspace& ws) const {
+        vector<int>& min_dist = ws.min_dist;
+        vector<pii>& pq = ws.heap;
+        auto cmp = greater<pii>();
+        min_dist.assign(adj.size(), INF);
+        pq.clear();
+
+        min_dist[src] = 0;
+        pq.push_back({0, src});
+
+        while (!pq.empty()) {
+            pop_heap(pq.begin(), pq.end(), cmp);
+            int curr_dist = pq.back().first;
+            int curr = pq.back().second;
+            pq.pop_back();
+
+            if (curr_dist > min_dist[curr])
+                continue;
+
+            for (auto u : adj[curr]) {
+                int next = u.first;
+                int weight = u.second;
+
+                if (min_dist[next] > min_dist[curr] + weight) {
+                    min_dist[next] = min_dist[curr] + weight;
+                    pq.push_back({min_dist[next], next});
+                    push_heap(pq.begin(), pq.end(), cmp);
+                }
             }
         }
+        return min_dist;
     }
-}
+};
 
 int main() {
     int V, E, src;
@@ -61,17 +85,20 @@ int main() {
     cout << "Enter number of vertices and edges: ";
     cin >> V >> E;
 
+    vector<vector<pii>> adj(V);
     for (int i = 0; i < E; i++) {
         int u, v, wt;
         cout << "Enter vertex u, vertex v and weight: ";
         cin >> u >> v >> wt;
-        addEdge(u, v, wt);
+        addEdge(adj, u, v, wt);
     }
 
     cout << "Enter the source node: ";
     cin >> src;
 
-    dijkstra(src);
+    Dijkstra dijkstra(adj);
+    Dijkstra::Workspace ws;
+    const vector<int>& min_dist = dijkstra.run(src, ws);
 
     cout << "\nMinimum distances from source node " << src << ":\n";
     for (int i = 0; i < V; i++) {
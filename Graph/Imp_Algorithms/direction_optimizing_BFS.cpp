@@ -0,0 +1,272 @@
+/*
+Direction Optimizing BFS (Beamer et al.) - multi threaded
+Reference -> http://www.scott.beamer.org/papers/beamer_sc2012.pdf
+
+Plain BFS (BFS.cpp) is "top-down": every frontier vertex scans all its edges.
+In the middle levels of a low diameter graph the frontier is huge and almost every
+scanned edge goes to an already visited vertex -> wasted work.
+
+"Bottom-up" step: every UNVISITED vertex looks for ANY neighbor in the frontier and
+stops at the first one it finds. When the frontier is big this checks far fewer edges.
+
+Switching rule (alpha = 14, beta = 24 from the paper):
+    top-down  -> bottom-up  when  mf > mu / alpha   (mf = edges out of frontier, mu = edges of unvisited vertices)
+    bottom-up -> top-down   when  nf < n / beta     (nf = vertices in frontier)
+
+Parallelism:
+    top-down  : frontier is split between threads, a vertex is claimed with an atomic
+                fetch_or on the visited bitmap, each thread fills its own next frontier.
+    bottom-up : vertex range is split between threads in chunks of 64 vertices so that
+                every bitmap word is written by a single thread.
+
+Graph is undirected (like BFS.cpp), stored as CSR with vertices 0..n-1.
+Time complexity: O(V + E) work per BFS
+Returns level[] (-1 if unreachable) and parent[] (-1 for src and unreachable vertices).
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+struct CSR {
+    int n = 0;
+    vector<long long> offsets;  // size n+1
+    vector<int> neighbors;
+
+    // Undirected graph from an edge list
+    CSR(int vertices, const vector<pair<int, int>>& edges) {
+        n = vertices;
+        offsets.assign(n + 1, 0);
+        for (auto& e : edges) {
+            offsets[e.first + 1]++;
+            offsets[e.second + 1]++;
+        }
+        for (int u = 0; u < n; u++) offsets[u + 1] += offsets[u];
+        neighbors.resize(offsets[n]);
+        vector<long long> pos(offsets.begin(), offsets.end() - 1);
+        for (auto& e : edges) {
+            neighbors[pos[e.first]++] = e.second;
+            neighbors[pos[e.second]++] = e.first;
+        }
+    }
+
+    long long degree(int u) const { return offsets[u + 1] - offsets[u]; }
+};
+
+struct BFSResult {
+    vector<int> level;
+    vector<int> parent;
+    int topDownSteps = 0, bottomUpSteps = 0;
+};
+
+// Bitmap with one bit per vertex
+class Bitmap {
+private:
+    vector<atomic<uint64_t>> words;
+
+public:
+    Bitmap(int n) : words((n + 63) / 64) { clear(); }
+
+    void clear() {
+        for (auto& w : words) w.store(0, memory_order_relaxed);
+    }
+    bool get(int i) const {
+        return words[i >> 6].load(memory_order_relaxed) >> (i & 63) & 1;
+    }
+    // Sets bit i, returns true if this call changed it from 0 to 1
+    bool claim(int i) {
+        uint64_t bit = 1ULL << (i & 63);
+        return !(words[i >> 6].fetch_or(bit, memory_order_relaxed) & bit);
+    }
+    // Only safe when no other thread writes the same word
+    void setUnshared(int i) {
+        words[i >> 6].store(words[i >> 6].load(memory_order_relaxed) | 1ULL << (i & 63), memory_order_relaxed);
+    }
+    void swap(Bitmap& other) { words.swap(other.words); }
+};
+
+// Runs fn(threadId, begin, end) on numThreads threads over [0, total) split in chunks aligned to `align`
+template <typename F>
+void parallelFor(int numThreads, long long total, long long align, F fn) {
+    long long per = (total + numThreads - 1) / numThreads;
+    per = (per + align - 1) / align * align;
+    if (numThreads == 1 || total <= align) {
+        fn(0, 0LL, total);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < numThreads; t++) {
+        long long b = min(total, t * per), e = min(total, b + per);
+        if (b >= e) break;
+        workers.emplace_back(fn, t, b, e);
+    }
+    for (auto& w : workers) w.join();
+}
+
+BFSResult directionOptimizingBFS(const CSR& g, int src, int numThreads, int alpha = 14, int beta = 24) {
+    int n = g.n;
+    BFSResult res;
+    res.level.assign(n, -1);
+    res.parent.assign(n, -1);
+
+    Bitmap visited(n), front(n), next(n);
+    vector<int> frontier = {src};
+    vector<vector<int>> localNext(numThreads);
+    vector<long long> localEdges(numThreads), localCount(numThreads);
+
+    visited.claim(src);
+    res.level[src] = 0;
+
+    long long mu = (long long)g.neighbors.size() - g.degree(src); // edges of unvisited vertices
+    long long mf = g.degree(src);                                 // edges out of frontier
+    long long nf = 1;                                             // frontier size
+    bool bottomUp = false;
+
+    for (int depth = 0; nf > 0; depth++) {
+        if (!bottomUp && mf > mu / alpha) {
+            // switch to bottom-up: frontier list -> bitmap
+            bottomUp = true;
+            front.clear();
+            for (int u : frontier) front.setUnshared(u);
+        } else if (bottomUp && nf < n / beta) {
+            // switch to top-down: frontier bitmap -> list
+            bottomUp = false;
+            frontier.clear();
+            for (int v = 0; v < n; v++)
+                if (res.level[v] == depth) frontier.push_back(v);
+        }
+
+        if (!bottomUp) {
+            res.topDownSteps++;
+            parallelFor(numThreads, (long long)frontier.size(), 1, [&](int t, long long b, long long e) {
+                vector<int>& out = localNext[t];
+                out.clear();
+                long long edges = 0;
+                for (long long i = b; i < e; i++) {
+                    int u = frontier[i];
+                    for (long long k = g.offsets[u]; k < g.offsets[u + 1]; k++) {
+                        int v = g.neighbors[k];
+                        if (!visited.get(v) && visited.claim(v)) {
+                            res.parent[v] = u;
+                            res.level[v] = depth + 1;
+                            out.push_back(v);
+                            edges += g.degree(v);
+                        }
+                    }
+                }
+                localEdges[t] = edges;
+            });
+            frontier.clear();
+            mf = 0;
+            for (int t = 0; t < numThreads; t++) {
+                frontier.insert(frontier.end(), localNext[t].begin(), localNext[t].end());
+                mf += localEdges[t];
+                localNext[t].clear();
+                localEdges[t] = 0;
+            }
+            nf = (long long)frontier.size();
+        } else {
+            res.bottomUpSteps++;
+            next.clear();
+            parallelFor(numThreads, n, 64, [&](int t, long long b, long long e) {
+                long long edges = 0, count = 0;
+                for (long long v = b; v < e; v++) {
+                    if (visited.get(v)) continue;
+                    for (long long k = g.offsets[v]; k < g.offsets[v + 1]; k++) {
+                        int u = g.neighbors[k];
+                        if (front.get(u)) {
+                            res.parent[v] = u;
+                            res.level[v] = depth + 1;
+                            next.setUnshared(v);
+                            edges += g.degree(v);
+                            count++;
+                            break;  // one parent is enough
+                        }
+                    }
+                }
+                localEdges[t] = edges;
+                localCount[t] = count;
+            });
+            // mark the new frontier visited only after the step so it is not used as a parent too early
+            mf = nf = 0;
+            for (int t = 0; t < numThreads; t++) {
+                mf += localEdges[t];
+                nf += localCount[t];
+                localEdges[t] = localCount[t] = 0;
+            }
+            parallelFor(numThreads, n, 64, [&](int, long long b, long long e) {
+                for (long long v = b; v < e; v++)
+                    if (next.get(v)) visited.setUnshared(v);
+            });
+            front.swap(next);
+        }
+        mu -= mf;
+    }
+    return res;
+}
+
+// Serial queue BFS from BFS.cpp, returning levels, used as reference
+vector<int> bfsLevels(const CSR& g, int src) {
+    vector<int> level(g.n, -1);
+    queue<int> q;
+    level[src] = 0;
+    q.push(src);
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        for (long long k = g.offsets[u]; k < g.offsets[u + 1]; k++) {
+            int v = g.neighbors[k];
+            if (level[v] == -1) {
+                level[v] = level[u] + 1;
+                q.push(v);
+            }
+        }
+    }
+    return level;
+}
+
+// parent[v] must be a neighbor of v one level closer to src
+bool validParents(const CSR& g, const BFSResult& r, int src) {
+    for (int v = 0; v < g.n; v++) {
+        if (v == src || r.level[v] == -1) continue;
+        int p = r.parent[v];
+        if (p < 0 || r.level[p] != r.level[v] - 1) return false;
+        if (find(g.neighbors.begin() + g.offsets[v], g.neighbors.begin() + g.offsets[v + 1], p) ==
+            g.neighbors.begin() + g.offsets[v + 1])
+            return false;
+    }
+    return true;
+}
+
+// Usage: ./a.out [vertices] [edges] [max threads]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    long long m = argc > 2 ? atoll(argv[2]) : 8000000;
+    int maxThreads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+
+    // Random low diameter graph
+    mt19937 rng(7);
+    vector<pair<int, int>> edges(m);
+    for (auto& e : edges) e = {(int)(rng() % n), (int)(rng() % n)};
+    CSR g(n, edges);
+    int src = 0;
+
+    auto t0 = chrono::steady_clock::now();
+    vector<int> expected = bfsLevels(g, src);
+    double serialMs = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    cout << "Vertices: " << n << ", edges: " << m << "\n";
+    cout << "Queue BFS (BFS.cpp): " << serialMs << " ms\n";
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        auto t = chrono::steady_clock::now();
+        BFSResult r = directionOptimizingBFS(g, src, threads);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+        bool ok = r.level == expected && validParents(g, r, src);
+        cout << "Direction optimizing BFS, " << threads << " thread(s): " << ms << " ms"
+             << " (top-down steps " << r.topDownSteps << ", bottom-up steps " << r.bottomUpSteps << ")"
+             << (ok ? "" : "  WRONG RESULT") << "\n";
+    }
+    return 0;
+}
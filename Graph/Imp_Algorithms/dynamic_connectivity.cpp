@@ -0,0 +1,610 @@
+/*
+    Que: Same as union_find_algo.cpp (makeFriend(a,b) / isFriend(a,b)) but friends can also
+    unFriend(a,b). A disjoint set can only join sets, it can't split them again, so every
+    unFriend would mean rebuilding everything from scratch.
+
+    1. Offline (all operations known in advance) - divide and conquer over time
+        Ref: https://cp-algorithms.com/data_structures/deleting_in_log_n.html
+        -> Every friendship is alive during some time intervals [added, removed)
+        -> Put each interval on O(log q) nodes of a segment tree over time
+        -> DFS the segment tree: on entering a node union its edges, on leaving ROLL BACK those unions.
+           At a leaf the disjoint set contains exactly the edges alive at that moment -> answer query
+        -> Rollback needs union by size WITHOUT path compression (every union changes one parent)
+        -> Time O(q log q log n)
+
+    2. Online - Holm, de Lichtenberg, Thorup (HDT)
+        Ref: "Poly-logarithmic deterministic fully-dynamic algorithms for connectivity" (JACM 2001)
+        -> Keep a spanning forest. Every edge has a level 0..log n, levels only go up.
+        -> F_i = forest of tree edges with level >= i, stored as Euler tour trees (treaps)
+           so link / cut / "same tree?" / "tree size" are O(log n)
+        -> Deleting a non tree edge: just forget it
+        -> Deleting a tree edge (u,v) of level l: for i = l..0 look for a replacement edge
+           between the two halves in F_i. Search only the SMALLER half Tu:
+             * raise every level i tree edge of Tu to level i+1 (Tu is small enough to fit there)
+             * check level i non tree edges of Tu: one going to the other half is the replacement,
+               the ones staying inside Tu are raised to level i+1 (that is what pays for the search)
+        -> Amortized O(log^2 n) per add / remove, O(log n) per isFriend
+*/
+
+#include <bits/stdc++.h>
+
+using namespace std;
+
+struct Query
+{
+    int type; // 0 = makeFriend, 1 = unFriend, 2 = isFriend
+    int x, y;
+};
+
+static long long edgeKey(int x, int y)
+{
+    if (x > y)
+        swap(x, y);
+    return (long long)x << 32 | (unsigned)y;
+}
+
+
+/*************************** 1. Offline *****************************/
+
+// Union by size, no path compression, every union can be undone (same as rollback_union_find.cpp)
+class RollbackDSU
+{
+public:
+    vector<int> parent, sz;
+    vector<int> history; // roots that were hung below another root, in order
+
+    RollbackDSU(int n) : parent(n), sz(n, 1) { iota(parent.begin(), parent.end(), 0); }
+
+    int find(int x)
+    {
+        while (parent[x] != x)
+            x = parent[x];
+        return x;
+    }
+
+    void weightedUnion(int x, int y)
+    {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+            return;
+        if (sz[x] < sz[y])
+            swap(x, y);
+        parent[y] = x;
+        sz[x] += sz[y];
+        history.push_back(y);
+    }
+
+    size_t checkpoint() { return history.size(); }
+
+    void rollback(size_t to)
+    {
+        while (history.size() > to)
+        {
+            int y = history.back();
+            history.pop_back();
+            sz[parent[y]] -= sz[y];
+            parent[y] = y;
+        }
+    }
+};
+
+class OfflineDynamicConnectivity
+{
+private:
+    int q;
+    vector<vector<pair<int, int>>> seg; // segment tree over time, edges alive on the whole node range
+    const vector<Query> &ops;
+    vector<int> answers;
+
+    void addInterval(int node, int l, int r, int ql, int qr, pair<int, int> e)
+    {
+        if (qr <= l || r <= ql)
+            return;
+        if (ql <= l && r <= qr)
+        {
+            seg[node].push_back(e);
+            return;
+        }
+        int mid = (l + r) / 2;
+        addInterval(2 * node, l, mid, ql, qr, e);
+        addInterval(2 * node + 1, mid, r, ql, qr, e);
+    }
+
+    void dfs(int node, int l, int r, RollbackDSU &dsu)
+    {
+        size_t cp = dsu.checkpoint();
+        for (auto &e : seg[node])
+            dsu.weightedUnion(e.first, e.second);
+        if (r - l == 1)
+        {
+            if (ops[l].type == 2)
+                answers.push_back(dsu.find(ops[l].x) == dsu.find(ops[l].y));
+        }
+        else
+        {
+            int mid = (l + r) / 2;
+            dfs(2 * node, l, mid, dsu);
+            dfs(2 * node + 1, mid, r, dsu);
+        }
+        dsu.rollback(cp);
+    }
+
+public:
+    OfflineDynamicConnectivity(const vector<Query> &ops) : q(ops.size()), seg(4 * max<size_t>(1, ops.size())), ops(ops) {}
+
+    // answers of the isFriend queries in order
+    vector<int> solve(int n)
+    {
+        // friendship alive while its count > 0 (same pair can be added twice)
+        unordered_map<long long, pair<int, int>> open; // key -> {count, start time}
+        for (int t = 0; t < q; t++)
+        {
+            const Query &op = ops[t];
+            if (op.type == 2 || op.x == op.y)
+                continue;
+            long long key = edgeKey(op.x, op.y);
+            if (op.type == 0)
+            {
+                auto &o = open[key];
+                if (o.first++ == 0)
+                    o.second = t;
+            }
+            else
+            {
+                auto it = open.find(key);
+                if (it == open.end())
+                    continue;
+                if (--it->second.first == 0)
+                {
+                    addInterval(1, 0, q, it->second.second, t, {op.x, op.y});
+                    open.erase(it);
+                }
+            }
+        }
+        for (auto &o : open)
+            addInterval(1, 0, q, o.second.second, q, {(int)(o.first >> 32), (int)(o.first & 0xffffffff)});
+
+        RollbackDSU dsu(n);
+        answers.clear();
+        if (q > 0)
+            dfs(1, 0, q, dsu);
+        return answers;
+    }
+};
+
+
+/*************************** 2. Online (HDT) *****************************/
+
+// Node of an Euler tour treap: either a vertex (one per vertex per level) or an arc u->v of a tree edge
+struct ETNode
+{
+    ETNode *l = nullptr, *r = nullptr, *p = nullptr;
+    unsigned pri;
+    int size = 1, vcount;
+    int u, v;                      // vertex node: u = v = vertex, arc node: the arc
+    bool tree = false;             // arc: its edge has exactly this level (only set on one of the 2 arcs)
+    bool nonTree = false;          // vertex: has non tree edges of exactly this level
+    bool subTree = false, subNonTree = false;
+
+    ETNode(int u, int v, unsigned pri) : pri(pri), vcount(u == v), u(u), v(v) {}
+};
+
+namespace treap
+{
+    int size(ETNode *t) { return t ? t->size : 0; }
+    int vcount(ETNode *t) { return t ? t->vcount : 0; }
+
+    void pull(ETNode *t)
+    {
+        t->size = 1 + size(t->l) + size(t->r);
+        t->vcount = (t->u == t->v) + vcount(t->l) + vcount(t->r);
+        t->subTree = t->tree || (t->l && t->l->subTree) || (t->r && t->r->subTree);
+        t->subNonTree = t->nonTree || (t->l && t->l->subNonTree) || (t->r && t->r->subNonTree);
+        if (t->l)
+            t->l->p = t;
+        if (t->r)
+            t->r->p = t;
+    }
+
+    ETNode *merge(ETNode *a, ETNode *b)
+    {
+        if (!a || !b)
+            return a ? a : b;
+        if (a->pri > b->pri)
+        {
+            a->r = merge(a->r, b);
+            pull(a);
+            return a;
+        }
+        b->l = merge(a, b->l);
+        pull(b);
+        return b;
+    }
+
+    // a = first k nodes, b = the rest
+    void splitRec(ETNode *t, int k, ETNode *&a, ETNode *&b)
+    {
+        if (!t)
+        {
+            a = b = nullptr;
+            return;
+        }
+        if (size(t->l) >= k)
+        {
+            splitRec(t->l, k, a, t->l);
+            b = t;
+        }
+        else
+        {
+            splitRec(t->r, k - size(t->l) - 1, t->r, b);
+            a = t;
+        }
+        pull(t);
+    }
+
+    void split(ETNode *t, int k, ETNode *&a, ETNode *&b)
+    {
+        splitRec(t, k, a, b);
+        if (a)
+            a->p = nullptr;
+        if (b)
+            b->p = nullptr;
+    }
+
+    ETNode *root(ETNode *t)
+    {
+        while (t->p)
+            t = t->p;
+        return t;
+    }
+
+    int index(ETNode *t)
+    {
+        int k = size(t->l);
+        for (; t->p; t = t->p)
+            if (t == t->p->r)
+                k += size(t->p->l) + 1;
+        return k;
+    }
+
+    // recompute aggregates from t up to the root after a flag changed
+    void refresh(ETNode *t)
+    {
+        for (; t; t = t->p)
+            pull(t);
+    }
+
+    ETNode *findTree(ETNode *t)
+    {
+        while (t && t->subTree)
+        {
+            if (t->tree)
+                return t;
+            t = (t->l && t->l->subTree) ? t->l : t->r;
+        }
+        return nullptr;
+    }
+
+    ETNode *findNonTree(ETNode *t)
+    {
+        while (t && t->subNonTree)
+        {
+            if (t->nonTree)
+                return t;
+            t = (t->l && t->l->subNonTree) ? t->l : t->r;
+        }
+        return nullptr;
+    }
+}
+
+class DynamicConnectivity
+{
+private:
+    struct EdgeInfo
+    {
+        int level = 0, count = 1;
+        bool isTree = false;
+        vector<pair<ETNode *, ETNode *>> arcs; // arcs[i] = the two arc nodes in F_i (tree edges only)
+    };
+
+    int n, L;
+    mt19937 rng;
+    vector<vector<ETNode *>> vnode;                          // [level][vertex], created on first use
+    vector<unordered_map<int, unordered_set<int>>> nonTree; // [level][vertex] -> non tree neighbors
+    unordered_map<long long, EdgeInfo> edges;
+
+    ETNode *node(int i, int x)
+    {
+        if (!vnode[i][x])
+            vnode[i][x] = new ETNode(x, x, rng());
+        return vnode[i][x];
+    }
+
+    bool connectedAt(int i, int x, int y)
+    {
+        return x == y || treap::root(node(i, x)) == treap::root(node(i, y));
+    }
+
+    // rotate the tour so that x comes first
+    ETNode *reroot(int i, int x)
+    {
+        ETNode *t = node(i, x), *a, *b;
+        treap::split(treap::root(t), treap::index(t), a, b);
+        return treap::merge(b, a);
+    }
+
+    pair<ETNode *, ETNode *> link(int i, int x, int y)
+    {
+        ETNode *tx = reroot(i, x), *ty = reroot(i, y);
+        ETNode *xy = new ETNode(x, y, rng()), *yx = new ETNode(y, x, rng());
+        treap::merge(treap::merge(tx, xy), treap::merge(ty, yx));
+        return {xy, yx};
+    }
+
+    void cut(pair<ETNode *, ETNode *> arcs)
+    {
+        ETNode *a1 = arcs.first, *a2 = arcs.second;
+        if (treap::index(a1) > treap::index(a2))
+            swap(a1, a2);
+        // tour = A a1 B a2 C  ->  B is one tree, A + C the other
+        ETNode *A, *rest, *B, *C, *tmp;
+        treap::split(treap::root(a1), treap::index(a1), A, rest);
+        treap::split(rest, 1, tmp, rest);                       // drop a1
+        treap::split(rest, treap::index(a2), B, rest);
+        treap::split(rest, 1, tmp, C);                          // drop a2
+        treap::merge(A, C);
+        delete a1;
+        delete a2;
+    }
+
+    void setTreeFlag(ETNode *arc, bool on)
+    {
+        arc->tree = on;
+        treap::refresh(arc);
+    }
+
+    void updateNonTreeFlag(int i, int x)
+    {
+        ETNode *t = node(i, x);
+        auto it = nonTree[i].find(x);
+        bool on = it != nonTree[i].end() && !it->second.empty();
+        if (it != nonTree[i].end() && it->second.empty())
+            nonTree[i].erase(it);
+        if (t->nonTree != on)
+        {
+            t->nonTree = on;
+            treap::refresh(t);
+        }
+    }
+
+    void addNonTree(int i, int x, int y)
+    {
+        nonTree[i][x].insert(y);
+        nonTree[i][y].insert(x);
+        updateNonTreeFlag(i, x);
+        updateNonTreeFlag(i, y);
+    }
+
+    void removeNonTree(int i, int x, int y)
+    {
+        nonTree[i][x].erase(y);
+        nonTree[i][y].erase(x);
+        updateNonTreeFlag(i, x);
+        updateNonTreeFlag(i, y);
+    }
+
+    // Tree edge (x,y) was cut in F_0..F_i, look for a replacement on level i
+    bool replace(int x, int y, int i)
+    {
+        if (treap::vcount(treap::root(node(i, x))) > treap::vcount(treap::root(node(i, y))))
+            swap(x, y);
+
+        // 1. raise all level i tree edges of the small tree
+        while (ETNode *arc = treap::findTree(treap::root(node(i, x))))
+        {
+            setTreeFlag(arc, false);
+            EdgeInfo &e = edges[edgeKey(arc->u, arc->v)];
+            e.level = i + 1;
+            e.arcs.push_back(link(i + 1, arc->u, arc->v));
+            setTreeFlag(e.arcs[i + 1].first, true);
+        }
+
+        // 2. level i non tree edges of the small tree: replacement or raise
+        while (ETNode *vx = treap::findNonTree(treap::root(node(i, x))))
+        {
+            int a = vx->u;
+            while (nonTree[i].count(a))
+            {
+                int b = *nonTree[i][a].begin();
+                removeNonTree(i, a, b);
+                EdgeInfo &e = edges[edgeKey(a, b)];
+                if (connectedAt(i, a, b))
+                {
+                    e.level = i + 1;
+                    addNonTree(i + 1, a, b);
+                }
+                else
+                {
+                    e.isTree = true;
+                    for (int j = 0; j <= i; j++)
+                        e.arcs.push_back(link(j, a, b));
+                    setTreeFlag(e.arcs[i].first, true);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    DynamicConnectivity(int n) : n(n), rng(2024)
+    {
+        L = 1;
+        while ((1 << (L - 1)) < n)
+            L++;
+        L++;
+        vnode.assign(L, vector<ETNode *>(n, nullptr));
+        nonTree.resize(L);
+    }
+
+    ~DynamicConnectivity()
+    {
+        for (auto &e : edges)
+            for (auto &a : e.second.arcs)
+            {
+                delete a.first;
+                delete a.second;
+            }
+        for (auto &level : vnode)
+            for (ETNode *t : level)
+                delete t;
+    }
+
+    void makeFriend(int x, int y)
+    {
+        if (x == y)
+            return;
+        auto it = edges.find(edgeKey(x, y));
+        if (it != edges.end())
+        {
+            it->second.count++;
+            return;
+        }
+        EdgeInfo &e = edges[edgeKey(x, y)];
+        if (!connectedAt(0, x, y))
+        {
+            e.isTree = true;
+            e.arcs.push_back(link(0, x, y));
+            setTreeFlag(e.arcs[0].first, true);
+        }
+        else
+            addNonTree(0, x, y);
+    }
+
+    void unFriend(int x, int y)
+    {
+        auto it = edges.find(edgeKey(x, y));
+        if (it == edges.end() || --it->second.count > 0)
+            return;
+        EdgeInfo e = move(it->second);
+        edges.erase(it);
+        if (!e.isTree)
+        {
+            removeNonTree(e.level, x, y);
+            return;
+        }
+        for (int j = 0; j <= e.level; j++)
+            cut(e.arcs[j]);
+        for (int i = e.level; i >= 0; i--)
+            if (replace(x, y, i))
+                break;
+    }
+
+    bool isFriend(int x, int y) { return connectedAt(0, x, y); }
+};
+
+
+/*************************** Benchmark *****************************/
+
+// Random operations: makeFriend, unFriend of an existing friendship, isFriend
+vector<Query> randomOps(int n, int q, unsigned seed)
+{
+    mt19937 rng(seed);
+    vector<Query> ops;
+    vector<pair<int, int>> alive;
+    for (int i = 0; i < q; i++)
+    {
+        int r = rng() % 10;
+        if (r < 4 || alive.empty())
+        {
+            int x = rng() % n, y = rng() % n;
+            ops.push_back({0, x, y});
+            alive.push_back({x, y});
+        }
+        else if (r < 6)
+        {
+            int k = rng() % alive.size();
+            ops.push_back({1, alive[k].first, alive[k].second});
+            swap(alive[k], alive.back());
+            alive.pop_back();
+        }
+        else
+            ops.push_back({2, (int)(rng() % n), (int)(rng() % n)});
+    }
+    return ops;
+}
+
+// Rebuild a disjoint set from all alive friendships on every query
+vector<int> rebuildEveryQuery(int n, const vector<Query> &ops)
+{
+    unordered_map<long long, int> alive;
+    vector<int> answers;
+    for (auto &op : ops)
+    {
+        if (op.type == 0)
+            alive[edgeKey(op.x, op.y)]++;
+        else if (op.type == 1)
+        {
+            auto it = alive.find(edgeKey(op.x, op.y));
+            if (it != alive.end() && --it->second == 0)
+                alive.erase(it);
+        }
+        else
+        {
+            RollbackDSU dsu(n);
+            for (auto &e : alive)
+                dsu.weightedUnion(e.first >> 32, e.first & 0xffffffff);
+            answers.push_back(dsu.find(op.x) == dsu.find(op.y));
+        }
+    }
+    return answers;
+}
+
+vector<int> online(int n, const vector<Query> &ops)
+{
+    DynamicConnectivity dc(n);
+    vector<int> answers;
+    for (auto &op : ops)
+    {
+        if (op.type == 0)
+            dc.makeFriend(op.x, op.y);
+        else if (op.type == 1)
+            dc.unFriend(op.x, op.y);
+        else
+            answers.push_back(dc.isFriend(op.x, op.y));
+    }
+    return answers;
+}
+
+double timeMs(const function<void()> &fn)
+{
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [friends] [operations]
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int q = argc > 2 ? atoi(argv[2]) : 300000;
+
+    // Small case: check both against rebuilding from scratch
+    vector<Query> small = randomOps(3000, 6000, 1);
+    vector<int> expected, a, b;
+    double rebuildMs = timeMs([&] { expected = rebuildEveryQuery(3000, small); });
+    double offMs = timeMs([&] { a = OfflineDynamicConnectivity(small).solve(3000); });
+    double onMs = timeMs([&] { b = online(3000, small); });
+    cout << "3000 friends, 6000 operations\n";
+    cout << "  Rebuild per query: " << rebuildMs << " ms\n";
+    cout << "  Offline          : " << offMs << " ms" << (a == expected ? "" : "  WRONG") << "\n";
+    cout << "  Online (HDT)     : " << onMs << " ms" << (b == expected ? "" : "  WRONG") << "\n";
+
+    vector<Query> big = randomOps(n, q, 2);
+    offMs = timeMs([&] { a = OfflineDynamicConnectivity(big).solve(n); });
+    onMs = timeMs([&] { b = online(n, big); });
+    cout << n << " friends, " << q << " operations\n";
+    cout << "  Offline          : " << offMs << " ms\n";
+    cout << "  Online (HDT)     : " << onMs << " ms" << (a == b ? "" : "  DIFFERENT") << "\n";
+}
@@ -0,0 +1,347 @@
+/*
+Indexed Priority Queues with decrease-key, for Dijkstra and Prim
+
+dijkstra() (dijkstra.cpp) and prim() (prims_algo.cpp) push a new {dist, node} pair every time
+a distance improves and skip the stale ones on pop -> heap can hold O(E) entries.
+An INDEXED heap keeps at most one entry per vertex (pos[v] = where v sits in the heap),
+so an improvement is a decrease-key instead of a push -> heap size is O(V).
+
+1. IndexedDaryHeap<D>
+    -> D-ary heap stored in an array + position map
+    -> push / decreaseKey : O(log_D V) (sift up, fewer levels with bigger D)
+    -> pop                : O(D log_D V) (sift down looks at D children, they are contiguous in memory)
+    -> D = 2 is the normal binary heap, D = 4 is usually the fastest for Dijkstra
+
+2. RadixHeap (monotone priority queue, non-negative integer keys)
+    -> Only works if keys are never smaller than the last popped key (true for Dijkstra, NOT for Prim)
+    -> Bucket i holds keys whose highest differing bit with the last popped key is bit i-1
+    -> push / decreaseKey : O(1), pop: amortized O(log C) where C = max key
+    -> Every element moves down at most 32 buckets over its lifetime
+
+Both have the same interface so the algorithms take the heap as a template parameter:
+    dijkstra<IndexedDaryHeap<4>>(adj, src, stats)
+    prim<IndexedDaryHeap<2>>(adj, stats)
+HeapStats counts pushes, decrease-keys, pops and the largest heap size.
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+struct HeapStats {
+    long long pushes = 0, decreases = 0, pops = 0;
+    size_t maxSize = 0;
+};
+
+
+template <int D>
+class IndexedDaryHeap {
+private:
+    vector<pii> heap;   // {key, vertex}
+    vector<int> pos;    // pos[v] = index of v in heap, -1 if not in heap
+
+    void siftUp(int i) {
+        pii x = heap[i];
+        while (i > 0) {
+            int p = (i - 1) / D;
+            if (heap[p].first <= x.first) break;
+            heap[i] = heap[p];
+            pos[heap[i].second] = i;
+            i = p;
+        }
+        heap[i] = x;
+        pos[x.second] = i;
+    }
+
+    void siftDown(int i) {
+        int n = (int)heap.size();
+        pii x = heap[i];
+        while (true) {
+            int first = i * D + 1;
+            if (first >= n) break;
+            int best = first;
+            int last = min(first + D, n);
+            for (int c = first + 1; c < last; c++)
+                if (heap[c].first < heap[best].first) best = c;
+            if (heap[best].first >= x.first) break;
+            heap[i] = heap[best];
+            pos[heap[i].second] = i;
+            i = best;
+        }
+        heap[i] = x;
+        pos[x.second] = i;
+    }
+
+public:
+    static constexpr bool monotoneOnly = false;
+
+    IndexedDaryHeap(int n) : pos(n, -1) {}
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    bool contains(int v) const { return pos[v] != -1; }
+    int key(int v) const { return heap[pos[v]].first; }
+
+    void push(int v, int key) {
+        heap.push_back({key, v});
+        siftUp((int)heap.size() - 1);
+    }
+
+    // key must not be bigger than the current key of v
+    void decreaseKey(int v, int key) {
+        heap[pos[v]].first = key;
+        siftUp(pos[v]);
+    }
+
+    // Removes and returns {key, vertex} with the smallest key
+    pii pop() {
+        pii top = heap[0];
+        pos[top.second] = -1;
+        pii last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+
+class RadixHeap {
+private:
+    static const int B = 33;        // bucket 0 = equal to last, bucket i = highest differing bit i-1
+    vector<pii> buckets[B];         // {key, vertex}
+    vector<pii> where;              // where[v] = {bucket, index in bucket}, bucket -1 if not in heap
+    unsigned last = 0;              // last popped key
+    size_t count = 0;
+
+    int bucketOf(unsigned key) const {
+        return key == last ? 0 : 32 - __builtin_clz(key ^ last);
+    }
+
+    void place(int v, unsigned key) {
+        int b = bucketOf(key);
+        where[v] = {b, (int)buckets[b].size()};
+        buckets[b].push_back({(int)key, v});
+    }
+
+    void erase(int v) {
+        auto [b, i] = where[v];
+        pii moved = buckets[b].back();
+        buckets[b][i] = moved;
+        where[moved.second].second = i;
+        buckets[b].pop_back();
+        where[v].first = -1;
+    }
+
+public:
+    static constexpr bool monotoneOnly = true;
+
+    RadixHeap(int n) : where(n, {-1, -1}) {}
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+    bool contains(int v) const { return where[v].first != -1; }
+    int key(int v) const { return buckets[where[v].first][where[v].second].first; }
+
+    // key must be >= last popped key
+    void push(int v, int key) {
+        place(v, (unsigned)key);
+        count++;
+    }
+
+    void decreaseKey(int v, int key) {
+        erase(v);
+        place(v, (unsigned)key);
+    }
+
+    pii pop() {
+        if (buckets[0].empty()) {
+            // Find the first non-empty bucket and redistribute it around its minimum
+            int b = 1;
+            while (buckets[b].empty()) b++;
+            unsigned mn = UINT_MAX;
+            for (auto& e : buckets[b]) mn = min(mn, (unsigned)e.first);
+            last = mn;
+            vector<pii> moving;
+            moving.swap(buckets[b]);
+            for (auto& e : moving) place(e.second, (unsigned)e.first);
+        }
+        pii top = buckets[0].back();
+        buckets[0].pop_back();
+        where[top.second].first = -1;
+        count--;
+        return top;
+    }
+};
+
+
+// Dijkstra with true decrease-key. adj[u] = list of {v, wt}, returns min_dist (INF = unreachable)
+template <class Heap>
+vector<int> dijkstra(const vector<vector<pii>>& adj, int src, HeapStats& stats) {
+    int n = (int)adj.size();
+    vector<int> min_dist(n, INF);
+    Heap pq(n);
+
+    min_dist[src] = 0;
+    pq.push(src, 0);
+    stats.pushes++;
+
+    while (!pq.empty()) {
+        stats.maxSize = max(stats.maxSize, pq.size());
+        int curr = pq.pop().second;
+        stats.pops++;
+
+        for (auto& e : adj[curr]) {
+            int next = e.first;
+            int nd = min_dist[curr] + e.second;
+            if (nd < min_dist[next]) {
+                if (pq.contains(next)) {
+                    pq.decreaseKey(next, nd);
+                    stats.decreases++;
+                } else {
+                    pq.push(next, nd);
+                    stats.pushes++;
+                }
+                min_dist[next] = nd;
+            }
+        }
+    }
+    return min_dist;
+}
+
+// Prim's MST sum starting from node 0 (like prims_algo.cpp). key of a vertex = cheapest edge to the tree.
+template <class Heap>
+int prim(const vector<vector<pii>>& adj, HeapStats& stats) {
+    static_assert(!Heap::monotoneOnly, "Prim's keys are not monotone, use an IndexedDaryHeap");
+    int n = (int)adj.size();
+    vector<int> key(n, INF);
+    vector<bool> visited(n, false);
+    Heap pq(n);
+
+    int mst_sum = 0;
+    key[0] = 0;
+    pq.push(0, 0);
+    stats.pushes++;
+
+    while (!pq.empty()) {
+        stats.maxSize = max(stats.maxSize, pq.size());
+        pii top = pq.pop();
+        stats.pops++;
+        int curr = top.second;
+        visited[curr] = true;
+        mst_sum += top.first;
+
+        for (auto& e : adj[curr]) {
+            int next = e.first, wt = e.second;
+            if (!visited[next] && wt < key[next]) {
+                if (pq.contains(next)) {
+                    pq.decreaseKey(next, wt);
+                    stats.decreases++;
+                } else {
+                    pq.push(next, wt);
+                    stats.pushes++;
+                }
+                key[next] = wt;
+            }
+        }
+    }
+    return mst_sum;
+}
+
+
+// Lazy deletion versions from dijkstra.cpp / prims_algo.cpp, with the same counters
+vector<int> dijkstraLazy(const vector<vector<pii>>& adj, int src, HeapStats& stats) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<int> min_dist(adj.size(), INF);
+    min_dist[src] = 0;
+    pq.push({0, src});
+    stats.pushes++;
+    while (!pq.empty()) {
+        stats.maxSize = max(stats.maxSize, pq.size());
+        int curr_dist = pq.top().first;
+        int curr = pq.top().second;
+        pq.pop();
+        stats.pops++;
+        if (curr_dist > min_dist[curr])
+            continue;
+        for (auto& u : adj[curr]) {
+            if (min_dist[u.first] > curr_dist + u.second) {
+                min_dist[u.first] = curr_dist + u.second;
+                pq.push({min_dist[u.first], u.first});
+                stats.pushes++;
+            }
+        }
+    }
+    return min_dist;
+}
+
+int primLazy(const vector<vector<pii>>& adj, HeapStats& stats) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<bool> visited(adj.size(), false);
+    int mst_sum = 0;
+    pq.push({0, 0});
+    stats.pushes++;
+    while (pq.size()) {
+        stats.maxSize = max(stats.maxSize, pq.size());
+        int curr_node = pq.top().second;
+        int curr_dist = pq.top().first;
+        pq.pop();
+        stats.pops++;
+        if (visited[curr_node])
+            continue;
+        visited[curr_node] = true;
+        mst_sum += curr_dist;
+        for (auto& u : adj[curr_node]) {
+            if (!visited[u.first]) {
+                pq.push({u.second, u.first});
+                stats.pushes++;
+            }
+        }
+    }
+    return mst_sum;
+}
+
+
+template <class F>
+void report(const string& name, F run) {
+    HeapStats stats;
+    auto t = chrono::steady_clock::now();
+    long long checksum = run(stats);
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+    cout << setw(28) << left << name << setw(10) << right << fixed << setprecision(1) << ms << " ms"
+         << "  max heap " << setw(9) << stats.maxSize << "  pops " << setw(9) << stats.pops
+         << "  decrease-keys " << setw(9) << stats.decreases << "  result " << checksum << "\n";
+}
+
+// Usage: ./a.out [vertices] [edges]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+    long long m = argc > 2 ? atoll(argv[2]) : 2000000;
+
+    // Random connected undirected graph: a random spanning path + random edges
+    mt19937 rng(3);
+    vector<vector<pii>> adj(n);
+    auto addEdge = [&](int u, int v, int wt) {
+        adj[u].push_back({v, wt});
+        adj[v].push_back({u, wt});
+    };
+    for (int i = 1; i < n; i++) addEdge(i - 1, i, 1 + rng() % 10000);
+    for (long long i = n - 1; i < m; i++) addEdge(rng() % n, rng() % n, 1 + rng() % 10000);
+
+    // result column: sum of all distances for Dijkstra, MST weight for Prim (must match per algorithm)
+    auto sum = [](const vector<int>& d) { return accumulate(d.begin(), d.end(), 0LL); };
+    cout << "Vertices: " << n << ", edges: " << m << "\n";
+    report("Dijkstra priority_queue", [&](HeapStats& s) { return sum(dijkstraLazy(adj, 0, s)); });
+    report("Dijkstra binary heap", [&](HeapStats& s) { return sum(dijkstra<IndexedDaryHeap<2>>(adj, 0, s)); });
+    report("Dijkstra 4-ary heap", [&](HeapStats& s) { return sum(dijkstra<IndexedDaryHeap<4>>(adj, 0, s)); });
+    report("Dijkstra 8-ary heap", [&](HeapStats& s) { return sum(dijkstra<IndexedDaryHeap<8>>(adj, 0, s)); });
+    report("Dijkstra radix heap", [&](HeapStats& s) { return sum(dijkstra<RadixHeap>(adj, 0, s)); });
+    report("Prim priority_queue", [&](HeapStats& s) { return (long long)primLazy(adj, s); });
+    report("Prim binary heap", [&](HeapStats& s) { return (long long)prim<IndexedDaryHeap<2>>(adj, s); });
+    report("Prim 4-ary heap", [&](HeapStats& s) { return (long long)prim<IndexedDaryHeap<4>>(adj, s); });
+    return 0;
+}
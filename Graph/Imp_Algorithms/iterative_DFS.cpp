@@ -0,0 +1,225 @@
+/*
+Iterative (stack safe) DFS engine with visitor callbacks
+Time Complexity: O(V + E), Space: O(V) on the heap instead of the call stack
+
+dfs_recursive (DFS.cpp), Graph::dfs (graph2.cpp), isCyclicUtil (graph3.cpp) and notIsCyclic
+(topological_sort.cpp) recurse once per vertex. A path shaped graph with a few million vertices
+overflows the call stack (default 8MB ~ 100k-200k frames).
+
+dfs_iterative in DFS.cpp pushes ALL neighbors at once: stack can hold O(E) entries, and it does
+not give a real post order (can't tell when a vertex is finished), so it can't do cycle detection
+or topological sort.
+
+This engine keeps an explicit stack of frames {vertex, parent, index of next neighbor}.
+The top frame "resumes" its neighbor loop exactly where a recursive call would continue,
+so the visit order and pre/post order are identical to the recursive DFS.
+
+Visitor callbacks (all optional, see DFSVisitor):
+    preorder(u, parent)      -> vertex discovered (GREY)
+    edge(u, v, kind)         -> every edge u->v: TREE (v was WHITE), BACK (v GREY), FORWARD_OR_CROSS (v BLACK)
+    postorder(u, parent)     -> all neighbors of u done (BLACK)
+    stop()                   -> return true to abort the whole search early
+*/
+#include<bits/stdc++.h>
+using namespace std;
+
+typedef enum {WHITE, GREY, BLACK} col;
+enum EdgeKind {TREE, BACK, FORWARD_OR_CROSS};
+
+struct DFSVisitor
+{
+    void preorder(int, int) {}
+    void edge(int, int, EdgeKind) {}
+    void postorder(int, int) {}
+    bool stop() { return false; }
+};
+
+/*
+adj: anything with adj[u] being a range of ints (vector<vector<int>>, vector<int> adj[LIM], ...)
+color: WHITE/GREY/BLACK per vertex, shared between calls so a full-graph DFS can call this for every WHITE vertex
+Returns false if the visitor stopped the search.
+*/
+template <class Adj, class Visitor>
+bool iterativeDFS(const Adj& adj, int src, vector<col>& color, Visitor& vis)
+{
+    struct Frame { int u, parent; size_t next; };
+    vector<Frame> stck;
+
+    color[src] = GREY;
+    vis.preorder(src, -1);
+    stck.push_back({src, -1, 0});
+
+    while (!stck.empty())
+    {
+        if (vis.stop())
+            return false;
+
+        Frame& f = stck.back();
+        int u = f.u;
+        const auto& nbrs = adj[u];
+
+        if (f.next == nbrs.size())
+        {
+            // all neighbors done -> "return" from the recursive call
+            color[u] = BLACK;
+            int parent = f.parent;
+            stck.pop_back();
+            vis.postorder(u, parent);
+            continue;
+        }
+
+        int v = nbrs[f.next++];
+        if (color[v] == WHITE)
+        {
+            vis.edge(u, v, TREE);
+            color[v] = GREY;
+            vis.preorder(v, u);
+            stck.push_back({v, u, 0});     // "recursive call", f is invalid from here
+        }
+        else
+            vis.edge(u, v, color[v] == GREY ? BACK : FORWARD_OR_CROSS);
+    }
+    return !vis.stop();
+}
+
+
+/*************************** Algorithms rebuilt on the engine *****************************/
+
+// dfs_recursive (DFS.cpp) / Graph::dfs (graph2.cpp): vertices in visiting order
+template <class Adj>
+vector<int> dfsOrder(const Adj& adj, int V, int src)
+{
+    struct : DFSVisitor
+    {
+        vector<int> order;
+        void preorder(int u, int) { order.push_back(u); }
+    } vis;
+    vector<col> color(V, WHITE);
+    iterativeDFS(adj, src, color, vis);
+    return vis.order;
+}
+
+// isCyclic for a directed graph (graph3.cpp 1.a): a BACK edge closes a cycle
+template <class Adj>
+bool isCyclicDirected(const Adj& adj, int V)
+{
+    struct : DFSVisitor
+    {
+        bool found = false;
+        void edge(int, int, EdgeKind kind) { if (kind == BACK) found = true; }
+        bool stop() { return found; }
+    } vis;
+    vector<col> color(V, WHITE);
+    for (int i = 0; i < V && !vis.found; i++)
+        if (color[i] == WHITE)
+            iterativeDFS(adj, i, color, vis);
+    return vis.found;
+}
+
+// isCyclic for an undirected graph (graph3.cpp 1.b): an already visited neighbor that is not the parent
+template <class Adj>
+bool isCyclicUndirected(const Adj& adj, int V)
+{
+    struct Vis : DFSVisitor
+    {
+        vector<int> parent;
+        bool found = false;
+        void preorder(int u, int p) { parent[u] = p; }
+        void edge(int u, int v, EdgeKind kind) { if (kind != TREE && v != parent[u]) found = true; }
+        bool stop() { return found; }
+    } vis;
+    vis.parent.assign(V, -1);
+    vector<col> color(V, WHITE);
+    for (int i = 0; i < V && !vis.found; i++)
+        if (color[i] == WHITE)
+            iterativeDFS(adj, i, color, vis);
+    return vis.found;
+}
+
+// notIsCyclic + dfs (topological_sort.cpp): topological order, empty if there is a cycle
+template <class Adj>
+vector<int> topologicalSort(const Adj& adj, int V)
+{
+    struct : DFSVisitor
+    {
+        vector<int> post;
+        bool cyclic = false;
+        void edge(int, int, EdgeKind kind) { if (kind == BACK) cyclic = true; }
+        void postorder(int u, int) { post.push_back(u); }
+        bool stop() { return cyclic; }
+    } vis;
+    vector<col> color(V, WHITE);
+    for (int i = 0; i < V && !vis.cyclic; i++)
+        if (color[i] == WHITE)
+            iterativeDFS(adj, i, color, vis);
+    if (vis.cyclic)
+        return {};
+    reverse(vis.post.begin(), vis.post.end());
+    return vis.post;
+}
+
+
+/*************************** Benchmark *****************************/
+
+// dfs_recursive from DFS.cpp
+void dfs_recursive(const vector<vector<int>>& adj, int u, vector<bool>& visited, vector<int>& order)
+{
+    visited[u] = true;
+    order.push_back(u);
+    for (int v : adj[u])
+        if (!visited[v])
+            dfs_recursive(adj, v, visited, order);
+}
+
+double timeMs(const function<void()>& fn)
+{
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [chain length]
+int main(int argc, char* argv[])
+{
+    // Small example
+    vector<vector<int>> small = {{1, 2}, {3}, {3}, {}};
+    cout << "DFS order: ";
+    for (int u : dfsOrder(small, 4, 0)) cout << u << " ";
+    cout << "\nTopological order: ";
+    for (int u : topologicalSort(small, 4)) cout << u << " ";
+    cout << "\nDirected cycle: " << (isCyclicDirected(small, 4) ? "yes" : "no") << "\n";
+
+    // Same order as the recursive DFS on a random graph small enough for recursion
+    int n = 100000;
+    mt19937 rng(4);
+    vector<vector<int>> rnd(n);
+    for (int i = 0; i < 5 * n; i++) rnd[rng() % n].push_back(rng() % n);
+    vector<bool> visited(n, false);
+    vector<int> recOrder;
+    double recMs = timeMs([&] { dfs_recursive(rnd, 0, visited, recOrder); });
+    vector<int> itOrder;
+    double itMs = timeMs([&] { itOrder = dfsOrder(rnd, n, 0); });
+    cout << "\nRandom graph " << n << " vertices: recursive " << recMs << " ms, iterative " << itMs << " ms, "
+         << (recOrder == itOrder ? "same order" : "DIFFERENT ORDER") << "\n";
+
+    // Path 0 -> 1 -> ... -> N-1 : recursion would need N stack frames
+    int N = argc > 1 ? atoi(argv[1]) : 10000000;
+    vector<vector<int>> chain(N);
+    for (int i = 0; i + 1 < N; i++) chain[i].push_back(i + 1);
+
+    vector<int> order;
+    double orderMs = timeMs([&] { order = dfsOrder(chain, N, 0); });
+    vector<int> topo;
+    double topoMs = timeMs([&] { topo = topologicalSort(chain, N); });
+    bool cyc = false;
+    double cycMs = timeMs([&] { cyc = isCyclicDirected(chain, N); });
+
+    cout << "Chain of " << N << " vertices:\n";
+    cout << "  DFS order       : " << orderMs << " ms (" << order.size() << " vertices)\n";
+    cout << "  Topological sort: " << topoMs << " ms (" << (topo.size() == (size_t)N && topo[0] == 0 ? "ok" : "WRONG") << ")\n";
+    cout << "  Cycle check     : " << cycMs << " ms (" << (cyc ? "cycle" : "no cycle") << ")\n";
+
+    // Close the chain into a ring: one cycle of length N
+    chain[N - 1].push_back(0);
+    cout << "  Ring cycle check: " << (isCyclicDirected(chain, N) ? "cycle" : "NO CYCLE") << "\n";
+}
@@ -0,0 +1,227 @@
+/**
+ * @file johnson_apsp.cpp
+ * @brief Johnson's all pairs shortest paths for sparse graphs (negative edges allowed).
+ * Same input / output as findShortestDist in FloydWarshall.cpp:
+ *      matrix[i][j] = -1 means no road, answer has INF where j is unreachable from i.
+ *
+ * Floyd Warshall is O(V^3) no matter how many roads there are. With E roads,
+ * V runs of Dijkstra cost O(V * (V + E) log V), much less when E << V^2, but Dijkstra
+ * can't handle negative weights. Johnson fixes the weights first:
+ *      1. Potentials h[] with Bellman Ford from a virtual vertex joined to every vertex with
+ *         weight 0 (= start with h[v] = 0 for all v), early exit when a pass changes nothing.
+ *         A change in pass V means a negative cycle -> no answer (same as Floyd Warshall's
+ *         negative diagonal).
+ *      2. Reweight: w'(u,v) = w(u,v) + h[u] - h[v] >= 0 (triangle inequality of h),
+ *         every path from s to t changes by the same h[s] - h[t], so shortest paths stay shortest.
+ *      3. Dijkstra from every source on w'. Sources are independent -> handed out to threads,
+ *         each thread writes only its own rows of the matrix.
+ *      4. dist(s,t) = dist'(s,t) - h[s] + h[t]
+ *
+ * findShortestDistAuto() counts the roads and picks Johnson or Floyd Warshall.
+ * Time complexity: O(V*E) (Bellman Ford, usually far less) + O(V * (V + E) log V)
+ */
+
+#define INF 1e5+3
+
+#include<bits/stdc++.h>
+
+using namespace std;
+
+typedef pair<int, int> pii;
+
+struct Edge {
+    int u, v, wt;
+};
+
+// Bellman Ford from the virtual vertex, false if there is a negative cycle
+bool potentials(int n, const vector<Edge>& edges, vector<int>& h) {
+    h.assign(n, 0);
+    for (int pass = 0; pass < n; pass++) {
+        bool changed = false;
+        for (const Edge& e : edges)
+            if (h[e.u] + e.wt < h[e.v]) {
+                h[e.v] = h[e.u] + e.wt;
+                changed = true;
+            }
+        if (!changed) return true;
+    }
+    return false;
+}
+
+// Calls fn(threadId, task) for task in [0, tasks) using numThreads threads
+template <typename F>
+static void parallelTasks(int numThreads, int tasks, F fn) {
+    int T = max(1, min(numThreads, tasks));
+    atomic<int> nextTask(0);
+    auto work = [&](int tid) {
+        for (int task; (task = nextTask.fetch_add(1)) < tasks;) fn(tid, task);
+    };
+    vector<thread> workers;
+    for (int t = 1; t < T; t++) workers.emplace_back(work, t);
+    work(0);
+    for (auto& w : workers) w.join();
+}
+
+// Fills matrix[s][*] for every source s, false if there is a negative cycle (matrix untouched then)
+bool johnson(int n, const vector<Edge>& edges, vector<vector<int>>& matrix, int numThreads) {
+    vector<int> h;
+    if (!potentials(n, edges, h)) return false;
+
+    // CSR with reduced weights
+    vector<int> offsets(n + 1, 0);
+    for (const Edge& e : edges) offsets[e.u + 1]++;
+    for (int u = 0; u < n; u++) offsets[u + 1] += offsets[u];
+    vector<pii> adj(edges.size());
+    vector<int> pos(offsets.begin(), offsets.end() - 1);
+    for (const Edge& e : edges) adj[pos[e.u]++] = {e.v, e.wt + h[e.u] - h[e.v]};
+
+    const long long UNREACHED = LLONG_MAX;
+    matrix.assign(n, vector<int>(n, (int)(INF)));
+    int T = max(1, numThreads);
+    // per thread workspace
+    vector<vector<long long>> dist(T, vector<long long>(n, UNREACHED));
+    vector<vector<pair<long long, int>>> heaps(T);
+    vector<vector<int>> touched(T);
+
+    parallelTasks(T, n, [&](int tid, int s) {
+        vector<long long>& d = dist[tid];
+        vector<pair<long long, int>>& pq = heaps[tid];
+        auto cmp = greater<pair<long long, int>>();
+        d[s] = 0;
+        touched[tid].push_back(s);
+        pq.push_back({0, s});
+        while (!pq.empty()) {
+            pop_heap(pq.begin(), pq.end(), cmp);
+            auto [du, u] = pq.back();
+            pq.pop_back();
+            if (du > d[u]) continue;
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                auto [v, w] = adj[k];
+                if (du + w < d[v]) {
+                    if (d[v] == UNREACHED) touched[tid].push_back(v);
+                    d[v] = du + w;
+                    pq.push_back({d[v], v});
+                    push_heap(pq.begin(), pq.end(), cmp);
+                }
+            }
+        }
+        vector<int>& row = matrix[s];
+        for (int v : touched[tid]) {
+            row[v] = (int)(d[v] - h[s] + h[v]);
+            d[v] = UNREACHED;
+        }
+        touched[tid].clear();
+    });
+    return true;
+}
+
+// Drop in replacement of findShortestDist from FloydWarshall.cpp (false on a negative cycle)
+bool findShortestDistJohnson(vector<vector<int>>& matrix, int numThreads = max(1u, thread::hardware_concurrency())) {
+    int n = matrix.size();
+    vector<Edge> edges;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            if (matrix[i][j] != -1 && i != j) edges.push_back({i, j, matrix[i][j]});
+    return johnson(n, edges, matrix, numThreads);
+}
+
+// Textbook version from FloydWarshall.cpp
+void findShortestDist(vector<vector<int>>& matrix) {
+    int n = matrix.size(), i, j, k;
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < n; j++) {
+            if (matrix[i][j] == -1) matrix[i][j] = INF;
+            if (i == j) matrix[i][j] = 0;
+        }
+    }
+    for(k = 0; k < n; k++)
+        for(i = 0; i < n; i++)
+            for(j = 0; j < n; j++)
+                matrix[i][j] = min(matrix[i][j], matrix[i][k] + matrix[k][j]);
+}
+
+/*
+Johnson ~ V * E * log V heap work split between threads, Floyd Warshall ~ V^3 very simple steps
+on one thread. Measured on one core: Johnson wins while E * log2(V) < V^2 * FW_COST_RATIO.
+*/
+const double FW_COST_RATIO = 0.5;
+
+bool useJohnson(long long n, long long edges, int numThreads) {
+    return edges * log2(max(2LL, n)) < FW_COST_RATIO * max(1, numThreads) * n * n;
+}
+
+void findShortestDistAuto(vector<vector<int>>& matrix, int numThreads = max(1u, thread::hardware_concurrency())) {
+    long long n = matrix.size(), edges = 0;
+    for (auto& r : matrix)
+        for (int x : r) edges += x != -1;
+    if (useJohnson(n, edges, numThreads) && findShortestDistJohnson(matrix, numThreads)) return;
+    findShortestDist(matrix);
+}
+
+
+// Usage: ./a.out [vertices] [threads]
+int main(int argc, char* argv[]) {
+    // Example from FloydWarshall.cpp, plus a negative road 2 -> 0
+    int V = 4;
+    vector<vector<int> > matrix(V, vector<int>(V, -1));
+    matrix[0][1] = 2;
+    matrix[1][0] = 1;
+    matrix[1][2] = 3;
+    matrix[2][0] = -2;
+    matrix[3][0] = 3;
+    matrix[3][1] = 5;
+    matrix[3][2] = 4;
+
+    findShortestDistJohnson(matrix);
+    cout << "Following matrix shows the shortest distances between every pair of vertices \n";
+    for (int i = 0; i < V; i++) {
+        for (int j = 0; j < V; j++) {
+            if (matrix[i][j] == INF)
+                cout << "INF ";
+            else
+                cout << matrix[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    int n = argc > 1 ? atoi(argv[1]) : 800;
+    int threads = argc > 2 ? atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+
+    auto timeIt = [](auto fn) {
+        auto t = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+    };
+
+    // Random graphs of growing density. Road i -> j = random positive + p[i] - p[j] for a random p:
+    // some roads are negative but every cycle sums to a positive value (no negative cycle).
+    // Every i has a road to i+1 so everything is reachable
+    cout << "\nVertices: " << n << ", " << threads << " thread(s)\n";
+    for (int perVertex : {4, 16, 64, n / 4}) {
+        mt19937 rng(20);
+        vector<int> p(n);
+        for (auto& x : p) x = rng() % 50;
+        auto road = [&](int i, int j) {
+            int w = 1 + rng() % 100 + p[i] - p[j];
+            return w == -1 ? 0 : w;     // -1 means "no road" in this format
+        };
+        vector<vector<int>> input(n, vector<int>(n, -1));
+        for (int i = 0; i < n; i++) {
+            input[i][(i + 1) % n] = road(i, (i + 1) % n);
+            for (int k = 0; k < perVertex; k++) {
+                int j = rng() % n;
+                if (j != i) input[i][j] = road(i, j);
+            }
+        }
+        long long edges = 0;
+        for (auto& r : input)
+            for (int x : r) edges += x != -1;
+
+        vector<vector<int>> fw = input, jo = input;
+        double fwMs = timeIt([&] { findShortestDist(fw); });
+        double joMs = timeIt([&] { findShortestDistJohnson(jo, threads); });
+        cout << "  " << edges << " roads: Floyd Warshall " << fwMs << " ms, Johnson " << joMs << " ms"
+             << (fw == jo ? "" : "  DIFFERENT") << " -> auto picks " << (useJohnson(n, edges, threads) ? "Johnson" : "Floyd Warshall")
+             << "\n";
+    }
+}
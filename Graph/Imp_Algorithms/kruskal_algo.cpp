@@ -0,0 +1,243 @@
+/*
+Kruskal's Minimum Spanning Tree (using Disjoint Set / union_find_algo.cpp)
+Ref: https://cp-algorithms.com/graph/mst_kruskal_with_dsu.html
+Ref: Osipov, Sanders, Singler "The Filter-Kruskal Minimum Spanning Tree Algorithm"
+
+1. Kruskal: sort all edges by weight, take an edge if its endpoints are in different sets.
+    -> Time O(E log E) (the sort), unions are almost O(1)
+    -> Sort is done in parallel: every thread sorts one chunk, then chunks are merged pairwise
+
+2. Filter-Kruskal: in a sparse graph most heavy edges end up INSIDE a component and are
+   never used, so sorting them is wasted work.
+    -> Pick a pivot weight, split edges into light (<= pivot) and heavy (> pivot)
+    -> Solve the light edges first (recursively)
+    -> Throw away heavy edges whose endpoints are already connected (filter), recurse on the rest
+    -> Small inputs fall back to plain Kruskal
+    -> Expected time O(E + V log V log(E/V)) for random weights
+
+Unlike Prim (prims_algo.cpp) this also works on a disconnected graph (gives a forest).
+*/
+#include<bits/stdc++.h>
+using namespace std;
+
+struct Edge {
+    int u, v, wt;
+    bool operator<(const Edge& other) const { return wt < other.wt; }
+};
+
+// Union by size + path compression (same as union_find_algo.cpp)
+struct DSU {
+    vector<int> parent, sz;
+
+    DSU(int n) : parent(n), sz(n, 1) {
+        iota(parent.begin(), parent.end(), 0);
+    }
+
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // find without writing, safe to call from many threads while nobody unites
+    int findReadOnly(int x) const {
+        while (parent[x] != x) x = parent[x];
+        return x;
+    }
+
+    bool weightedUnion(int x, int y) {
+        int xRoot = find(x), yRoot = find(y);
+        if (xRoot == yRoot) return false;
+        if (sz[xRoot] < sz[yRoot]) swap(xRoot, yRoot);
+        parent[yRoot] = xRoot;
+        sz[xRoot] += sz[yRoot];
+        return true;
+    }
+};
+
+struct MSTResult {
+    long long weight = 0;
+    vector<Edge> edges;
+};
+
+// Sort with numThreads threads: sort chunks, then merge neighbouring chunks in parallel rounds
+void parallelSort(vector<Edge>& edges, int numThreads) {
+    size_t n = edges.size();
+    int T = max(1, min<int>(numThreads, (int)(n / 4096) + 1));
+    if (T == 1) {
+        sort(edges.begin(), edges.end());
+        return;
+    }
+    vector<size_t> bound(T + 1);
+    for (int t = 0; t <= T; t++) bound[t] = n * t / T;
+
+    vector<thread> workers;
+    for (int t = 0; t < T; t++)
+        workers.emplace_back([&, t] { sort(edges.begin() + bound[t], edges.begin() + bound[t + 1]); });
+    for (auto& w : workers) w.join();
+
+    for (int width = 1; width < T; width *= 2) {
+        workers.clear();
+        for (int t = 0; t + width < T; t += 2 * width) {
+            size_t b = bound[t], mid = bound[t + width], e = bound[min(T, t + 2 * width)];
+            workers.emplace_back([&edges, b, mid, e] {
+                inplace_merge(edges.begin() + b, edges.begin() + mid, edges.begin() + e);
+            });
+        }
+        for (auto& w : workers) w.join();
+    }
+}
+
+// Adds edges (already sorted) to the MST while they join different components
+void addSorted(const vector<Edge>& sorted, DSU& dsu, MSTResult& res) {
+    for (auto& e : sorted)
+        if (dsu.weightedUnion(e.u, e.v)) {
+            res.weight += e.wt;
+            res.edges.push_back(e);
+        }
+}
+
+MSTResult kruskal(int V, vector<Edge> edges, int numThreads = 1) {
+    MSTResult res;
+    DSU dsu(V);
+    parallelSort(edges, numThreads);
+    addSorted(edges, dsu, res);
+    return res;
+}
+
+
+class FilterKruskal {
+private:
+    DSU dsu;
+    MSTResult res;
+    int numThreads;
+    mt19937 rng;
+    static const size_t BASE = 1 << 14;   // below this: plain Kruskal
+
+    // Keep only edges whose endpoints are still in different components
+    void filter(vector<Edge>& edges) {
+        size_t n = edges.size();
+        int T = max(1, min<int>(numThreads, (int)(n / 4096) + 1));
+        vector<char> keep(n);
+        auto work = [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; i++)
+                keep[i] = dsu.findReadOnly(edges[i].u) != dsu.findReadOnly(edges[i].v);
+        };
+        if (T == 1) {
+            work(0, n);
+        } else {
+            vector<thread> workers;
+            for (int t = 0; t < T; t++) workers.emplace_back(work, n * t / T, n * (t + 1) / T);
+            for (auto& w : workers) w.join();
+        }
+        size_t j = 0;
+        for (size_t i = 0; i < n; i++)
+            if (keep[i]) edges[j++] = edges[i];
+        edges.resize(j);
+    }
+
+    void solve(vector<Edge>& edges) {
+        if ((int)res.edges.size() == (int)dsu.parent.size() - 1) return;  // tree already complete
+        if (edges.size() <= BASE) {
+            parallelSort(edges, 1);
+            addSorted(edges, dsu, res);
+            return;
+        }
+        // pivot = median weight of a small random sample
+        vector<int> sample(31);
+        for (auto& s : sample) s = edges[rng() % edges.size()].wt;
+        nth_element(sample.begin(), sample.begin() + 15, sample.end());
+        int pivot = sample[15];
+
+        auto mid = partition(edges.begin(), edges.end(), [&](const Edge& e) { return e.wt <= pivot; });
+        vector<Edge> heavy(mid, edges.end());
+        edges.erase(mid, edges.end());
+        if (heavy.empty()) {   // every weight <= pivot (many equal weights), nothing to split
+            parallelSort(edges, numThreads);
+            addSorted(edges, dsu, res);
+            return;
+        }
+
+        solve(edges);
+        edges.clear();
+        edges.shrink_to_fit();
+        filter(heavy);
+        solve(heavy);
+    }
+
+public:
+    FilterKruskal(int V, int numThreads = 1) : dsu(V), numThreads(numThreads), rng(12345) {}
+
+    MSTResult run(vector<Edge> edges) {
+        solve(edges);
+        return res;
+    }
+};
+
+
+// prim() from prims_algo.cpp (starts from node 0, graph must be connected)
+typedef pair<int, int> pii;
+long long prim(int V, const vector<Edge>& edges) {
+    vector<vector<pii>> adj(V);
+    for (auto& e : edges) {
+        adj[e.u].push_back({e.v, e.wt});
+        adj[e.v].push_back({e.u, e.wt});
+    }
+    vector<bool> visited(V, false);
+    priority_queue<pii, vector<pii>, greater<pii> > pq;
+    long long mst_sum = 0;
+    pq.push({0, 0});
+    while (pq.size()) {
+        int curr_node = pq.top().second;
+        int curr_dist = pq.top().first;
+        pq.pop();
+        if (visited[curr_node])
+            continue;
+        visited[curr_node] = true;
+        mst_sum += curr_dist;
+        for (auto u : adj[curr_node])
+            if (!visited[u.first])
+                pq.push({u.second, u.first});
+    }
+    return mst_sum;
+}
+
+template <class F>
+double timeMs(F fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [vertices] [edges] [threads]
+int main(int argc, char* argv[]) {
+    int V = argc > 1 ? atoi(argv[1]) : 200000;
+    int E = argc > 2 ? atoi(argv[2]) : 2000000;
+    int threads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+
+    // Connected sparse graph: random spanning path + random edges
+    mt19937 rng(9);
+    vector<Edge> edges;
+    for (int i = 1; i < V; i++) edges.push_back({i - 1, i, (int)(rng() % 1000000)});
+    while ((int)edges.size() < E) edges.push_back({(int)(rng() % V), (int)(rng() % V), (int)(rng() % 1000000)});
+    shuffle(edges.begin(), edges.end(), rng);
+
+    MSTResult a, b, c, d;
+    long long p = 0;
+    double primMs = timeMs([&] { p = prim(V, edges); });
+    double kMs = timeMs([&] { a = kruskal(V, edges, 1); });
+    double kParMs = timeMs([&] { b = kruskal(V, edges, threads); });
+    double fMs = timeMs([&] { c = FilterKruskal(V, 1).run(edges); });
+    double fParMs = timeMs([&] { d = FilterKruskal(V, threads).run(edges); });
+
+    cout << "Vertices: " << V << ", edges: " << E << "\n";
+    cout << "Prim                          : " << primMs << " ms, MST sum " << p << "\n";
+    cout << "Kruskal                       : " << kMs << " ms, MST sum " << a.weight << "\n";
+    cout << "Kruskal, parallel sort (" << threads << " thr) : " << kParMs << " ms, MST sum " << b.weight << "\n";
+    cout << "Filter-Kruskal                : " << fMs << " ms, MST sum " << c.weight << "\n";
+    cout << "Filter-Kruskal (" << threads << " thr)        : " << fParMs << " ms, MST sum " << d.weight << "\n";
+    bool same = a.weight == p && b.weight == p && c.weight == p && d.weight == p;
+    cout << (same ? "All MST sums match\n" : "MST SUMS DIFFER\n");
+}
@@ -0,0 +1,446 @@
+/*
+Binary graph file + mmap loading
+Every program here reads "V E" and then E lines "u v [wt]" through cin >> and addEdge, so a big graph
+is parsed from text on every run. Instead convert it ONCE into a binary CSR file (same layout as
+CSRGraph in CSR_graph.cpp) and map the file into memory: loading is O(1), nothing is parsed or copied,
+pages are read by the OS only when a traversal touches them (and stay cached between runs).
+
+File layout (native byte order, every array starts at a multiple of 64 bytes):
+    Header (64 bytes)
+        magic "CSRGRAPH", version, flags (directed / weighted / has id map)
+        numVertices, numEdges (stored edges: 2E for undirected)
+        byte position of each array below (0 if absent)
+    offsets   uint64[n + 1]       offsets[u] .. offsets[u+1] = range of u's neighbors
+    neighbors int32[numEdges]     internal ids 0..n-1
+    weights   int32[numEdges]     only if weighted
+    idMap     int32[n]            internal id -> original id, only if the ids were remapped
+
+Converter: edge list ("V E" + E lines, ids 0..V-1 like dijkstra.cpp / prims_algo.cpp) -> file,
+edges counting sorted by source exactly like CSRBuilder::freeze(). With remapIds any int can be an id
+(like Graph in graph1.cpp), ids are numbered in first-seen order and idMap keeps the original ones.
+
+GraphView = raw pointers to the arrays. MappedGraph::view() points into the mapping, CSR arrays
+in memory give the same view, so BFS / DFS / Dijkstra / Prim below run on either without a copy.
+Traversals take and return INTERNAL ids (use originalId() to print).
+Loading checks the header, array bounds and offsets; neighbor ids are only checked with
+MappedGraph(path, true), otherwise the neighbor array is trusted (traversals index by it).
+*/
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+enum GraphFlags : uint32_t { DIRECTED = 1, WEIGHTED = 2, HAS_ID_MAP = 4 };
+
+struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t numVertices;
+    uint64_t numEdges;
+    uint64_t offsetsPos, neighborsPos, weightsPos, idMapPos;
+};
+static_assert(sizeof(GraphFileHeader) == 64, "header must stay 64 bytes");
+
+const char GRAPH_MAGIC[8] = {'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H'};
+const uint32_t GRAPH_VERSION = 1;
+
+// Read only CSR arrays, owned by someone else (a mapping or vectors)
+struct GraphView {
+    int n = 0;
+    long long m = 0;
+    const uint64_t* offsets = nullptr;
+    const int* neighbors = nullptr;
+    const int* weights = nullptr;   // nullptr if unweighted (every edge weighs 1)
+    const int* idMap = nullptr;     // nullptr if ids were not remapped
+    bool directed = false;
+
+    int degree(int u) const { return (int)(offsets[u + 1] - offsets[u]); }
+    const int* nbrBegin(int u) const { return neighbors + offsets[u]; }
+    const int* nbrEnd(int u) const { return neighbors + offsets[u + 1]; }
+    int weight(uint64_t e) const { return weights ? weights[e] : 1; }
+    int originalId(int u) const { return idMap ? idMap[u] : u; }
+};
+
+
+// The file mapped read only. Move only, unmapped in the destructor.
+class MappedGraph {
+private:
+    void* base = MAP_FAILED;
+    size_t length = 0;
+    GraphView g;
+
+    void fail(const string& path, const string& why) {
+        close();
+        throw runtime_error(path + ": " + why);
+    }
+
+    // [pos, pos + bytes) must be inside the file and aligned for T
+    template <class T>
+    const T* array(const string& path, uint64_t pos, uint64_t count) {
+        if (pos % alignof(T) || pos > length || count > (length - pos) / sizeof(T))
+            fail(path, "array out of bounds, file truncated?");
+        return reinterpret_cast<const T*>(static_cast<const char*>(base) + pos);
+    }
+
+    void close() {
+        if (base != MAP_FAILED) munmap(base, length);
+        base = MAP_FAILED;
+        length = 0;
+        g = GraphView();
+    }
+
+public:
+    MappedGraph() {}
+
+    // Offsets are always checked (O(n)). checkNeighbors also checks every neighbor id < n (O(m), touches
+    // the whole file); leave it off only for files written by writeGraphFile() that are trusted.
+    explicit MappedGraph(const string& path, bool checkNeighbors = false) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) throw runtime_error(path + ": " + strerror(errno));
+        struct stat st;
+        if (fstat(fd, &st) == -1 || st.st_size < (off_t)sizeof(GraphFileHeader)) {
+            ::close(fd);
+            throw runtime_error(path + ": not a graph file");
+        }
+        length = st.st_size;
+        base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);        // the mapping keeps the file alive
+        if (base == MAP_FAILED) throw runtime_error(path + ": mmap failed");
+
+        const GraphFileHeader& h = *static_cast<const GraphFileHeader*>(base);
+        if (memcmp(h.magic, GRAPH_MAGIC, 8) != 0) fail(path, "bad magic");
+        if (h.version != GRAPH_VERSION) fail(path, "unsupported version");
+        if (h.numVertices > (uint64_t)INT_MAX) fail(path, "too many vertices");
+
+        g.n = (int)h.numVertices;
+        g.m = (long long)h.numEdges;
+        g.directed = h.flags & DIRECTED;
+        g.offsets = array<uint64_t>(path, h.offsetsPos, h.numVertices + 1);
+        g.neighbors = array<int>(path, h.neighborsPos, h.numEdges);
+        if (h.flags & WEIGHTED) g.weights = array<int>(path, h.weightsPos, h.numEdges);
+        if (h.flags & HAS_ID_MAP) g.idMap = array<int>(path, h.idMapPos, h.numVertices);
+        if (g.offsets[0] != 0 || g.offsets[g.n] != h.numEdges) fail(path, "corrupt offsets");
+        for (int u = 0; u < g.n; u++)
+            if (g.offsets[u] > g.offsets[u + 1]) fail(path, "corrupt offsets");
+        if (checkNeighbors)
+            for (long long e = 0; e < g.m; e++)
+                if ((unsigned)g.neighbors[e] >= (unsigned)g.n) fail(path, "neighbor id out of range");
+    }
+
+    MappedGraph(MappedGraph&& o) noexcept : base(o.base), length(o.length), g(o.g) {
+        o.base = MAP_FAILED;
+        o.length = 0;
+    }
+    MappedGraph& operator=(MappedGraph&& o) noexcept {
+        if (this != &o) {
+            close();
+            swap(base, o.base);
+            swap(length, o.length);
+            swap(g, o.g);
+        }
+        return *this;
+    }
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    ~MappedGraph() { close(); }
+
+    const GraphView& view() const { return g; }
+
+    // Hint for a full scan (BFS over everything): read ahead instead of one page fault per 4 KB.
+    // Advice values are not flags, so one call each.
+    void adviseSequential() const {
+        if (base == MAP_FAILED) return;
+        madvise(base, length, MADV_SEQUENTIAL);
+        madvise(base, length, MADV_WILLNEED);
+    }
+};
+
+
+/*************************** Converter *****************************/
+
+// CSR arrays in memory (what the converter builds before writing)
+struct CSRArrays {
+    vector<uint64_t> offsets;
+    vector<int> neighbors, weights, idMap;
+    bool directed = false;
+
+    GraphView view() const {
+        GraphView g;
+        g.n = (int)offsets.size() - 1;
+        g.m = (long long)neighbors.size();
+        g.offsets = offsets.data();
+        g.neighbors = neighbors.data();
+        g.weights = weights.empty() ? nullptr : weights.data();
+        g.idMap = idMap.empty() ? nullptr : idMap.data();
+        g.directed = directed;
+        return g;
+    }
+};
+
+// Reads "V E" and E lines "u v" (or "u v wt" if weighted). Counting sort by source like CSRBuilder::freeze(),
+// neighbors keep input order. Without remapIds, ids must be in [0, V).
+CSRArrays readEdgeList(istream& in, bool directed, bool weighted, bool remapIds) {
+    long long V, E;
+    if (!(in >> V >> E) || V < 0 || E < 0) throw runtime_error("edge list: expected \"V E\"");
+
+    vector<int> src(E), dst(E), wt(weighted ? E : 0);
+    unordered_map<int, int> indexOf;
+    CSRArrays a;
+    a.directed = directed;
+    auto id = [&](int v) {
+        if (!remapIds) {
+            if (v < 0 || v >= V) throw runtime_error("edge list: vertex " + to_string(v) + " out of range");
+            return v;
+        }
+        auto it = indexOf.find(v);
+        if (it != indexOf.end()) return it->second;
+        indexOf[v] = (int)a.idMap.size();
+        a.idMap.push_back(v);
+        return (int)a.idMap.size() - 1;
+    };
+    for (long long i = 0; i < E; i++) {
+        int u, v;
+        if (!(in >> u >> v) || (weighted && !(in >> wt[i])))
+            throw runtime_error("edge list: expected " + to_string(E) + " edges, got " + to_string(i));
+        src[i] = id(u);
+        dst[i] = id(v);
+    }
+    int n = remapIds ? (int)a.idMap.size() : (int)V;
+
+    a.offsets.assign(n + 1, 0);
+    for (long long i = 0; i < E; i++) {
+        a.offsets[src[i] + 1]++;
+        if (!directed) a.offsets[dst[i] + 1]++;
+    }
+    for (int u = 0; u < n; u++) a.offsets[u + 1] += a.offsets[u];
+
+    a.neighbors.resize(a.offsets[n]);
+    if (weighted) a.weights.resize(a.offsets[n]);
+    vector<uint64_t> pos(a.offsets.begin(), a.offsets.end() - 1);
+    for (long long i = 0; i < E; i++) {
+        uint64_t p = pos[src[i]]++;
+        a.neighbors[p] = dst[i];
+        if (weighted) a.weights[p] = wt[i];
+        if (!directed) {
+            uint64_t q = pos[dst[i]]++;
+            a.neighbors[q] = src[i];
+            if (weighted) a.weights[q] = wt[i];
+        }
+    }
+    return a;
+}
+
+void writeGraphFile(const CSRArrays& a, const string& path) {
+    auto align = [](uint64_t x) { return (x + 63) / 64 * 64; };
+    uint64_t n = a.offsets.size() - 1, m = a.neighbors.size();
+
+    GraphFileHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, GRAPH_MAGIC, 8);
+    h.version = GRAPH_VERSION;
+    h.flags = 0;
+    if (a.directed) h.flags |= DIRECTED;
+    if (!a.weights.empty()) h.flags |= WEIGHTED;
+    if (!a.idMap.empty()) h.flags |= HAS_ID_MAP;
+    h.numVertices = n;
+    h.numEdges = m;
+    uint64_t end = sizeof(h);
+    h.offsetsPos = align(end);
+    end = h.offsetsPos + (n + 1) * sizeof(uint64_t);
+    h.neighborsPos = align(end);
+    end = h.neighborsPos + m * sizeof(int);
+    if (!a.weights.empty()) {
+        h.weightsPos = align(end);
+        end = h.weightsPos + m * sizeof(int);
+    }
+    if (!a.idMap.empty()) h.idMapPos = align(end);
+
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) throw runtime_error(path + ": cannot create");
+    auto put = [&](uint64_t pos, const void* data, uint64_t bytes) {
+        static const char zeros[64] = {};
+        out.write(zeros, pos - (uint64_t)out.tellp());     // padding up to the aligned position
+        out.write(static_cast<const char*>(data), bytes);
+    };
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    put(h.offsetsPos, a.offsets.data(), (n + 1) * sizeof(uint64_t));
+    put(h.neighborsPos, a.neighbors.data(), m * sizeof(int));
+    if (h.weightsPos) put(h.weightsPos, a.weights.data(), m * sizeof(int));
+    if (h.idMapPos) put(h.idMapPos, a.idMap.data(), n * sizeof(int));
+    if (!out.flush()) throw runtime_error(path + ": write failed");
+}
+
+void convertEdgeList(istream& in, const string& path, bool directed, bool weighted, bool remapIds = false) {
+    writeGraphFile(readEdgeList(in, directed, weighted, remapIds), path);
+}
+
+
+/*************************** Algorithms on a GraphView *****************************/
+
+// BFS.cpp, the queue is a plain vector used as a FIFO
+vector<int> bfs(const GraphView& g, int src) {
+    vector<char> visited(g.n, 0);
+    vector<int> q;
+    q.reserve(g.n);
+    visited[src] = 1;
+    q.push_back(src);
+    for (size_t head = 0; head < q.size(); head++) {
+        int u = q[head];
+        for (const int* p = g.nbrBegin(u); p != g.nbrEnd(u); p++)
+            if (!visited[*p]) {
+                visited[*p] = 1;
+                q.push_back(*p);
+            }
+    }
+    return q;
+}
+
+// Recursive order of dfs_recursive() in DFS.cpp, with an explicit stack of (vertex, next edge)
+vector<int> dfs(const GraphView& g, int src) {
+    vector<char> visited(g.n, 0);
+    vector<int> order;
+    vector<pair<int, uint64_t>> stck;
+    visited[src] = 1;
+    order.push_back(src);
+    stck.push_back({src, g.offsets[src]});
+    while (!stck.empty()) {
+        auto& [u, it] = stck.back();
+        if (it == g.offsets[u + 1]) {
+            stck.pop_back();
+            continue;
+        }
+        int v = g.neighbors[it++];
+        if (!visited[v]) {
+            visited[v] = 1;
+            order.push_back(v);
+            stck.push_back({v, g.offsets[v]});
+        }
+    }
+    return order;
+}
+
+// dijkstra.cpp, INF = unreachable
+vector<int> dijkstra(const GraphView& g, int src) {
+    vector<int> min_dist(g.n, INF);
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    min_dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        auto [curr_dist, curr] = pq.top();
+        pq.pop();
+        if (curr_dist > min_dist[curr]) continue;
+        for (uint64_t e = g.offsets[curr]; e < g.offsets[curr + 1]; e++) {
+            int v = g.neighbors[e], nd = curr_dist + g.weight(e);
+            if (nd < min_dist[v]) {
+                min_dist[v] = nd;
+                pq.push({nd, v});
+            }
+        }
+    }
+    return min_dist;
+}
+
+// prim() from prims_algo.cpp (undirected graphs). Restarted from every unvisited vertex,
+// so a disconnected graph gives the weight of its minimum spanning forest.
+long long prim(const GraphView& g) {
+    vector<char> visited(g.n, 0);
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    long long mst_sum = 0;
+    for (int s = 0; s < g.n; s++) {
+        if (visited[s]) continue;
+        pq.push({0, s});
+        while (!pq.empty()) {
+            auto [curr_dist, curr_node] = pq.top();
+            pq.pop();
+            if (visited[curr_node]) continue;
+            visited[curr_node] = 1;
+            mst_sum += curr_dist;
+            for (uint64_t e = g.offsets[curr_node]; e < g.offsets[curr_node + 1]; e++)
+                if (!visited[g.neighbors[e]]) pq.push({g.weight(e), g.neighbors[e]});
+        }
+    }
+    return mst_sum;
+}
+
+
+/*************************** Benchmark *****************************/
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out convert <edge list> <graph file> [directed] [unweighted] [remap]
+//        ./a.out [vertices] [edges] [work dir]        (benchmark)
+int main(int argc, char* argv[]) {
+    if (argc > 1 && string(argv[1]) == "convert") {
+        if (argc < 4) {
+            cerr << "Usage: " << argv[0] << " convert <edge list> <graph file> [directed] [unweighted] [remap]\n";
+            return 1;
+        }
+        set<string> opts(argv + 4, argv + argc);
+        ifstream in(argv[2]);
+        try {
+            convertEdgeList(in, argv[3], opts.count("directed"), !opts.count("unweighted"), opts.count("remap"));
+            MappedGraph mg(argv[3], true);
+            cout << argv[3] << ": " << mg.view().n << " vertices, " << mg.view().m << " stored edges\n";
+        } catch (const exception& e) {
+            cerr << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    long long m = argc > 2 ? atoll(argv[2]) : 5000000;
+    string dir = argc > 3 ? argv[3] : "/tmp";
+    string textPath = dir + "/graph_edges.txt", binPath = dir + "/graph_edges.csr";
+
+    // Random connected weighted graph in the text format of prims_algo.cpp / dijkstra.cpp
+    {
+        mt19937 rng(22);
+        ofstream out(textPath);
+        out << n << " " << m + n - 1 << "\n";
+        for (int v = 1; v < n; v++) out << rng() % v << " " << v << " " << 1 + rng() % 100 << "\n";
+        for (long long i = 0; i < m; i++) out << rng() % n << " " << rng() % n << " " << 1 + rng() % 100 << "\n";
+    }
+
+    CSRArrays text;
+    double parseMs = timeMs([&] {
+        ifstream in(textPath);
+        text = readEdgeList(in, false, true, false);
+    });
+    double writeMs = timeMs([&] { writeGraphFile(text, binPath); });
+    MappedGraph mg;
+    double mapMs = timeMs([&] { mg = MappedGraph(binPath); });
+
+    const GraphView& a = text.view();
+    const GraphView& b = mg.view();
+    cout << "Graph " << b.n << " vertices, " << b.m << " stored edges\n";
+    cout << "  parse text + build CSR : " << parseMs << " ms\n";
+    cout << "  write binary file      : " << writeMs << " ms\n";
+    cout << "  mmap binary file       : " << mapMs << " ms\n";
+
+    auto row = [&](const string& name, auto fn) {
+        decltype(fn(a)) ra, rb;
+        double ms = timeMs([&] { ra = fn(a); });
+        double mms = timeMs([&] { rb = fn(b); });
+        cout << "  " << name << ": in memory " << ms << " ms, mapped " << mms << " ms" << (ra == rb ? "" : "  DIFFERENT") << "\n";
+    };
+    mg.adviseSequential();      // the traversals below visit the whole graph
+    row("BFS     ", [](const GraphView& g) { return bfs(g, 0); });
+    row("DFS     ", [](const GraphView& g) { return dfs(g, 0); });
+    row("Dijkstra", [](const GraphView& g) { return dijkstra(g, 0); });
+    row("Prim    ", [](const GraphView& g) { return prim(g); });
+
+    remove(textPath.c_str());
+    remove(binPath.c_str());
+}
@@ -0,0 +1,229 @@
+/*
+Parallel Connected Components on a flat (CSR) undirected graph
+Ref: Shiloach, Vishkin "An O(log n) parallel connectivity algorithm" (1982)
+Ref: Sutton, Ben-Nun, Barak "Optimizing Parallel Graph Connectivity Computation via Subgraph Sampling" (Afforest, 2018)
+
+find_connected_components (graph3.cpp) does a recursive dfs over unordered_map / unordered_set and
+builds one vector per component. Here the answer is ONE array: comp[v] = smallest vertex id in v's
+component (so two vertices are connected iff comp[u] == comp[v]).
+
+Both algorithms keep a forest in comp[] (comp[v] = parent, root points to itself) and always hang
+the root with the BIGGER id below the smaller one, so the final root is the minimum id.
+
+1. Shiloach-Vishkin
+    -> Hook    : for every edge (u,v) in parallel, if comp[v] is a root with a bigger id than comp[u],
+                 CAS it to point to comp[u]
+    -> Shortcut: comp[v] = comp[comp[v]] until every vertex points straight to its root
+    -> Repeat until a round hooks nothing. O(log V) rounds, O((V + E) log V) work
+
+2. Afforest (subgraph sampling)
+    -> Link only the first 2 neighbors of every vertex -> most of the giant component is already found
+    -> Sample some vertices to guess the biggest component c
+    -> For vertices NOT in c, link the remaining neighbors. Vertices of c (usually most of the graph)
+       skip their remaining edges completely -> work is close to O(V) instead of O(E)
+    -> Linking is lock-free (CAS on the root) like concurrent_union_find.cpp
+
+Vertices are 0..n-1, threads share the vertex range.
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+struct CSR {
+    int n = 0;
+    vector<long long> offsets;
+    vector<int> neighbors;
+
+    // Undirected graph from an edge list
+    CSR(int vertices, const vector<pair<int, int>>& edges) {
+        n = vertices;
+        offsets.assign(n + 1, 0);
+        for (auto& e : edges) {
+            offsets[e.first + 1]++;
+            offsets[e.second + 1]++;
+        }
+        for (int u = 0; u < n; u++) offsets[u + 1] += offsets[u];
+        neighbors.resize(offsets[n]);
+        vector<long long> pos(offsets.begin(), offsets.end() - 1);
+        for (auto& e : edges) {
+            neighbors[pos[e.first]++] = e.second;
+            neighbors[pos[e.second]++] = e.first;
+        }
+    }
+};
+
+// Calls fn(begin, end) on numThreads threads over [0, total)
+template <typename F>
+void parallelFor(int numThreads, long long total, F fn) {
+    if (numThreads <= 1) {
+        fn(0LL, total);
+        return;
+    }
+    vector<thread> workers;
+    for (int t = 0; t < numThreads; t++)
+        workers.emplace_back(fn, total * t / numThreads, total * (t + 1) / numThreads);
+    for (auto& w : workers) w.join();
+}
+
+// Point every vertex directly to its root
+void compress(vector<atomic<int>>& comp, int numThreads) {
+    parallelFor(numThreads, comp.size(), [&](long long b, long long e) {
+        for (long long v = b; v < e; v++) {
+            int p = comp[v].load(memory_order_relaxed);
+            while (p != comp[p].load(memory_order_relaxed)) p = comp[p].load(memory_order_relaxed);
+            comp[v].store(p, memory_order_relaxed);
+        }
+    });
+}
+
+vector<int> toVector(const vector<atomic<int>>& comp) {
+    vector<int> labels(comp.size());
+    for (size_t i = 0; i < comp.size(); i++) labels[i] = comp[i].load(memory_order_relaxed);
+    return labels;
+}
+
+
+vector<int> shiloachVishkin(const CSR& g, int numThreads) {
+    vector<atomic<int>> comp(g.n);
+    for (int i = 0; i < g.n; i++) comp[i].store(i, memory_order_relaxed);
+
+    atomic<bool> changed(true);
+    while (changed) {
+        changed = false;
+        // Hook
+        parallelFor(numThreads, g.n, [&](long long b, long long e) {
+            bool local = false;
+            for (long long u = b; u < e; u++)
+                for (long long k = g.offsets[u]; k < g.offsets[u + 1]; k++) {
+                    int v = g.neighbors[k];
+                    int cu = comp[u].load(memory_order_relaxed);
+                    int cv = comp[v].load(memory_order_relaxed);
+                    if (cu < cv && cv == comp[cv].load(memory_order_relaxed) &&
+                        comp[cv].compare_exchange_strong(cv, cu, memory_order_relaxed))
+                        local = true;
+                }
+            if (local) changed = true;
+        });
+        // Shortcut
+        compress(comp, numThreads);
+    }
+    return toVector(comp);
+}
+
+
+class Afforest {
+private:
+    const CSR& g;
+    int numThreads;
+    vector<atomic<int>> comp;
+    static const int NEIGHBOR_ROUNDS = 2;
+    static const int SAMPLES = 1024;
+
+    // Lock-free union: hang the bigger root under the smaller one
+    void link(int u, int v) {
+        int p1 = comp[u].load(memory_order_relaxed);
+        int p2 = comp[v].load(memory_order_relaxed);
+        while (p1 != p2) {
+            int high = max(p1, p2), low = min(p1, p2);
+            int pHigh = comp[high].load(memory_order_relaxed);
+            if (pHigh == low) break;                                      // already linked
+            if (pHigh == high && comp[high].compare_exchange_strong(pHigh, low, memory_order_relaxed))
+                break;                                                    // high was a root, linked now
+            p1 = comp[comp[high].load(memory_order_relaxed)].load(memory_order_relaxed);
+            p2 = comp[low].load(memory_order_relaxed);
+        }
+    }
+
+    // Most frequent label among random vertices
+    int sampleLargest() {
+        mt19937 rng(27491095);
+        unordered_map<int, int> count;
+        for (int i = 0; i < SAMPLES; i++) count[comp[rng() % g.n].load(memory_order_relaxed)]++;
+        return max_element(count.begin(), count.end(),
+                           [](const pair<const int, int>& a, const pair<const int, int>& b) { return a.second < b.second; })
+            ->first;
+    }
+
+public:
+    Afforest(const CSR& g, int numThreads) : g(g), numThreads(numThreads), comp(g.n) {}
+
+    vector<int> run() {
+        for (int i = 0; i < g.n; i++) comp[i].store(i, memory_order_relaxed);
+        if (g.n == 0) return {};
+
+        // Phase 1: first NEIGHBOR_ROUNDS neighbors of every vertex
+        for (int r = 0; r < NEIGHBOR_ROUNDS; r++) {
+            parallelFor(numThreads, g.n, [&](long long b, long long e) {
+                for (long long u = b; u < e; u++)
+                    if (g.offsets[u] + r < g.offsets[u + 1]) link(u, g.neighbors[g.offsets[u] + r]);
+            });
+            compress(comp, numThreads);
+        }
+
+        // Phase 2: skip the (probably) giant component, finish everything else
+        int c = sampleLargest();
+        parallelFor(numThreads, g.n, [&](long long b, long long e) {
+            for (long long u = b; u < e; u++) {
+                if (comp[u].load(memory_order_relaxed) == c) continue;
+                for (long long k = g.offsets[u] + NEIGHBOR_ROUNDS; k < g.offsets[u + 1]; k++)
+                    link(u, g.neighbors[k]);
+            }
+        });
+        compress(comp, numThreads);
+        return toVector(comp);
+    }
+};
+
+
+// Single threaded BFS labeling with the same labels (smallest id of the component)
+vector<int> bfsLabels(const CSR& g) {
+    vector<int> comp(g.n, -1), q;
+    q.reserve(g.n);
+    for (int s = 0; s < g.n; s++) {
+        if (comp[s] != -1) continue;
+        q.clear();
+        q.push_back(s);
+        comp[s] = s;
+        for (size_t h = 0; h < q.size(); h++)
+            for (long long k = g.offsets[q[h]]; k < g.offsets[q[h] + 1]; k++)
+                if (comp[g.neighbors[k]] == -1) {
+                    comp[g.neighbors[k]] = s;
+                    q.push_back(g.neighbors[k]);
+                }
+    }
+    return comp;
+}
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [vertices] [edges] [threads]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 2000000;
+    long long m = argc > 2 ? atoll(argv[2]) : 10000000;
+    int threads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+
+    // Dense random graph (one giant component) and a very sparse one (many components)
+    for (long long edgesCount : {m, (long long)n / 2}) {
+        mt19937 rng(12);
+        vector<pair<int, int>> edges(edgesCount);
+        for (auto& e : edges) e = {(int)(rng() % n), (int)(rng() % n)};
+        CSR g(n, edges);
+
+        vector<int> expected, sv, af;
+        double bfsMs = timeMs([&] { expected = bfsLabels(g); });
+        double svMs = timeMs([&] { sv = shiloachVishkin(g, threads); });
+        double afMs = timeMs([&] { af = Afforest(g, threads).run(); });
+
+        long long components = 0;
+        for (int v = 0; v < n; v++) components += expected[v] == v;
+        cout << "Vertices: " << n << ", edges: " << edgesCount << ", components: " << components << "\n";
+        cout << "  BFS labeling (1 thread)      : " << bfsMs << " ms\n";
+        cout << "  Shiloach-Vishkin (" << threads << " thread(s)): " << svMs << " ms"
+             << (sv == expected ? "" : "  WRONG") << "\n";
+        cout << "  Afforest (" << threads << " thread(s))        : " << afMs << " ms"
+             << (af == expected ? "" : "  WRONG") << "\n";
+    }
+}
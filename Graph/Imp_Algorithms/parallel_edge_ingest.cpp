@@ -0,0 +1,388 @@
+/*
+Streaming edge list ingestion with parallel parsing
+dijkstra.cpp / prims_algo.cpp (and Graph::addEdge in graph1.cpp) take edges one at a time through cin >>:
+one thread, locale aware number parsing, and a push_back into a separate vector per vertex for
+every edge. For a dump of many GB that is the whole run time.
+
+1. Streaming: the file is read in blocks of blockBytes (memory for text stays bounded), the
+   unfinished last line of a block is carried over to the next one. While the threads parse
+   block k the reader already reads block k+1.
+2. Parallel parsing: every block is cut into one chunk per thread at line boundaries, each thread
+   parses its chunk into its own edge arrays (no locks). The parser is a plain digit loop
+   (no locale, no stream state), lines are "u v" or "u v wt", separated by spaces / tabs / commas,
+   lines starting with '#' or '%' are comments (SNAP / Matrix Market style).
+3. Parallel counting sort by source (the freeze() of CSR_graph.cpp with threads):
+    -> chunks are split into T runs of consecutive chunks, thread t counts its edges per source
+       into cnt[t][v]
+    -> per vertex, prefix over threads: cnt[t][v] = edges of v in runs before t
+    -> offsets[] = prefix sum of the degrees (block wise in parallel)
+    -> thread t writes its edges to offsets[u] + cnt[t][u]++
+   Neighbors of a vertex keep FILE order, so the result is exactly what the addEdge loop builds.
+
+Memory of the sort: T * V ints for cnt, plus the parsed edges.
+Vertex ids must be 0..V-1 like dijkstra.cpp (for arbitrary ids use CSRBuilder in CSR_graph.cpp).
+*/
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+typedef pair<int, int> pii;
+
+struct IngestOptions {
+    bool directed = false;
+    bool header = false;            // first line is "V E" (input format of dijkstra.cpp / prims_algo.cpp)
+    int threads = max(1u, thread::hardware_concurrency());
+    size_t blockBytes = 64 << 20;
+};
+
+// Same arrays as CSRGraph in CSR_graph.cpp, ids are the ones from the file
+struct IngestedGraph {
+    vector<long long> offsets;      // size n+1
+    vector<int> neighbors;
+    vector<int> weights;            // empty if no line had a weight
+    long long edges = 0;            // lines read
+
+    int numVertices() const { return (int)offsets.size() - 1; }
+
+    // vector<vector<pii>> adjacency of dijkstra.cpp / prims_algo.cpp, filled in parallel
+    vector<vector<pii>> toAdjacency(int numThreads) const;
+};
+
+// Edges of one chunk of the file, in file order
+struct EdgeChunk {
+    vector<int> src, dst, wt;
+    bool weighted = false;
+    int maxId = -1;
+};
+
+// Calls fn(threadId) on numThreads threads (caller is thread 0), rethrows the first exception
+template <class F>
+static void parallelRun(int numThreads, F fn) {
+    vector<exception_ptr> errors(numThreads);
+    auto guarded = [&](int tid) {
+        try {
+            fn(tid);
+        } catch (...) {
+            errors[tid] = current_exception();
+        }
+    };
+    vector<thread> workers;
+    for (int t = 1; t < numThreads; t++) workers.emplace_back(guarded, t);
+    guarded(0);
+    for (auto& w : workers) w.join();
+    for (auto& e : errors)
+        if (e) rethrow_exception(e);
+}
+
+
+/*************************** Parser *****************************/
+
+[[noreturn]] static void parseError(long long byte, const string& what) {
+    throw runtime_error("edge list, byte " + to_string(byte) + ": " + what);
+}
+
+// Parses the complete lines in [p, end). filePos = file offset of p (for error messages).
+static void parseChunk(const char* p, const char* end, long long filePos, EdgeChunk& out) {
+    const char* begin = p;
+    while (p < end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+        if (p == end) break;
+        if (*p == '\n') {
+            p++;
+            continue;
+        }
+        if (*p == '#' || *p == '%') {
+            const char* nl = (const char*)memchr(p, '\n', end - p);
+            p = nl ? nl + 1 : end;
+            continue;
+        }
+
+        long long val[3];
+        int k = 0;
+        const char* lineStart = p;
+        while (p < end && *p != '\n') {
+            char c = *p;
+            if (c == ' ' || c == '\t' || c == '\r' || c == ',') {
+                p++;
+                continue;
+            }
+            bool neg = c == '-';
+            if (neg) p++;
+            if (p == end || *p < '0' || *p > '9')
+                parseError(filePos + (p - begin), string("unexpected character '") + c + "'");
+            long long x = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                x = x * 10 + (*p++ - '0');
+                if (x > INT_MAX) parseError(filePos + (lineStart - begin), "number does not fit in int");
+            }
+            if (k == 3) parseError(filePos + (lineStart - begin), "more than 3 numbers on a line");
+            val[k++] = neg ? -x : x;
+        }
+        if (k < 2) parseError(filePos + (lineStart - begin), "expected \"u v\" or \"u v wt\"");
+        if (val[0] < 0 || val[1] < 0) parseError(filePos + (lineStart - begin), "negative vertex id");
+
+        out.src.push_back((int)val[0]);
+        out.dst.push_back((int)val[1]);
+        out.wt.push_back(k == 3 ? (int)val[2] : 1);
+        out.weighted |= k == 3;
+        out.maxId = max(out.maxId, (int)max(val[0], val[1]));
+    }
+}
+
+
+/*************************** Streaming reader *****************************/
+
+// Reads the whole file, returns its chunks in file order. minVertices = V from the header (if any).
+static vector<EdgeChunk> readChunks(const string& path, const IngestOptions& opt, long long& minVertices) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) throw runtime_error(path + ": " + strerror(errno));
+    unique_ptr<int, void (*)(int*)> closer(&fd, [](int* f) { close(*f); });    // also on parse errors
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    int T = max(1, opt.threads);
+    size_t blockBytes = max<size_t>(opt.blockBytes, 1 << 16);
+    vector<char> buf[2];
+    buf[0].resize(blockBytes);
+    buf[1].resize(blockBytes);
+    vector<EdgeChunk> chunks;
+    long long filePos = 0;          // file offset of buf[cur][0]
+    size_t filled = 0;              // bytes in buf[cur]
+    bool eof = false, first = true;
+    minVertices = 0;
+
+    // fills buf[b] from position `from` to the end (or EOF)
+    auto fill = [&](int b, size_t from) {
+        while (from < buf[b].size() && !eof) {
+            ssize_t r = read(fd, buf[b].data() + from, buf[b].size() - from);
+            if (r < 0) throw runtime_error(path + ": read failed");
+            if (r == 0) eof = true;
+            from += r;
+        }
+        return from;
+    };
+
+    int cur = 0;
+    filled = fill(cur, 0);
+    while (filled > 0) {
+        char* data = buf[cur].data();
+
+        // complete lines end at the last '\n', the rest goes to the next block
+        size_t usable = filled;
+        if (!eof) {
+            const char* nl = (const char*)memrchr(data, '\n', filled);
+            if (!nl) {
+                if (filled == buf[cur].size()) buf[cur].resize(buf[cur].size() * 2);   // line longer than a block
+                filled = fill(cur, filled);
+                continue;
+            }
+            usable = nl - data + 1;
+        }
+
+        size_t start = 0;
+        if (first && opt.header) {
+            size_t nl = find(data, data + usable, '\n') - data;
+            long long V = 0, E = 0;
+            istringstream hdr(string(data, nl));
+            if (!(hdr >> V >> E) || V < 0) parseError(0, "expected header \"V E\"");
+            minVertices = V;
+            start = min(nl + 1, usable);
+        }
+        first = false;
+
+        // chunk boundaries at line starts
+        vector<size_t> cut(T + 1, usable);
+        cut[0] = start;
+        for (int t = 1; t < T; t++) {
+            size_t c = max(cut[t - 1], start + (usable - start) * t / T);
+            while (c < usable && c > start && data[c - 1] != '\n') c++;
+            cut[t] = c;
+        }
+        size_t base = chunks.size();
+        chunks.resize(base + T);
+
+        // parse this block while the main thread reads the next one
+        int nxt = 1 - cur;
+        size_t carry = filled - usable;
+        if (buf[nxt].size() < carry + (1 << 16)) buf[nxt].resize(carry + blockBytes);
+        memcpy(buf[nxt].data(), data + usable, carry);
+        size_t nextFilled = 0;
+        parallelRun(T, [&](int tid) {
+            if (tid == 0 && T > 1) nextFilled = fill(nxt, carry);
+            parseChunk(data + cut[tid], data + cut[tid + 1], filePos + cut[tid], chunks[base + tid]);
+        });
+        if (T == 1) nextFilled = fill(nxt, carry);
+        filePos += usable;
+        filled = nextFilled;
+        cur = nxt;
+    }
+    return chunks;
+}
+
+
+/*************************** Parallel counting sort *****************************/
+
+IngestedGraph ingestEdgeList(const string& path, const IngestOptions& opt = IngestOptions()) {
+    long long headerV;
+    vector<EdgeChunk> chunks = readChunks(path, opt, headerV);
+    int T = max(1, opt.threads);
+
+    IngestedGraph g;
+    int maxId = -1;
+    bool weighted = false;
+    vector<long long> chunkStart(chunks.size() + 1, 0);
+    for (size_t c = 0; c < chunks.size(); c++) {
+        maxId = max(maxId, chunks[c].maxId);
+        weighted |= chunks[c].weighted;
+        chunkStart[c + 1] = chunkStart[c] + chunks[c].src.size();
+    }
+    g.edges = chunkStart.back();
+    int n = (int)max<long long>(maxId + 1, headerV);
+    bool directed = opt.directed;
+
+    // thread t sorts chunks [runStart[t], runStart[t+1]), about the same number of edges each
+    vector<size_t> runStart(T + 1, chunks.size());
+    runStart[0] = 0;
+    for (int t = 1; t < T; t++)
+        runStart[t] = upper_bound(chunkStart.begin(), chunkStart.end() - 1, g.edges * t / T) - chunkStart.begin() - 1;
+    for (int t = 1; t <= T; t++) runStart[t] = max(runStart[t], runStart[t - 1]);
+
+    // 1. count
+    vector<vector<int>> cnt(T);
+    parallelRun(T, [&](int t) {
+        cnt[t].assign(n, 0);
+        for (size_t c = runStart[t]; c < runStart[t + 1]; c++)
+            for (size_t i = 0; i < chunks[c].src.size(); i++) {
+                cnt[t][chunks[c].src[i]]++;
+                if (!directed) cnt[t][chunks[c].dst[i]]++;
+            }
+    });
+
+    // 2. per vertex prefix over threads, degree -> offsets (block wise scan)
+    g.offsets.assign(n + 1, 0);
+    vector<long long> blockSum(T + 1, 0);
+    auto range = [&](int t) { return make_pair((long long)n * t / T, (long long)n * (t + 1) / T); };
+    parallelRun(T, [&](int t) {
+        auto [lo, hi] = range(t);
+        long long sum = 0;
+        for (long long v = lo; v < hi; v++) {
+            int run = 0;
+            for (int s = 0; s < T; s++) {
+                int c = cnt[s][v];
+                cnt[s][v] = run;
+                run += c;
+            }
+            g.offsets[v + 1] = run;
+            sum += run;
+        }
+        blockSum[t + 1] = sum;
+    });
+    for (int t = 0; t < T; t++) blockSum[t + 1] += blockSum[t];
+    parallelRun(T, [&](int t) {
+        auto [lo, hi] = range(t);
+        long long run = blockSum[t];
+        for (long long v = lo; v < hi; v++) {
+            run += g.offsets[v + 1];
+            g.offsets[v + 1] = run;
+        }
+    });
+
+    // 3. scatter, every thread owns disjoint slots
+    g.neighbors.resize(g.offsets[n]);
+    if (weighted) g.weights.resize(g.offsets[n]);
+    parallelRun(T, [&](int t) {
+        vector<int>& pos = cnt[t];
+        for (size_t c = runStart[t]; c < runStart[t + 1]; c++) {
+            EdgeChunk& ch = chunks[c];
+            for (size_t i = 0; i < ch.src.size(); i++) {
+                int u = ch.src[i], v = ch.dst[i];
+                long long p = g.offsets[u] + pos[u]++;
+                g.neighbors[p] = v;
+                if (weighted) g.weights[p] = ch.wt[i];
+                if (!directed) {
+                    long long q = g.offsets[v] + pos[v]++;
+                    g.neighbors[q] = u;
+                    if (weighted) g.weights[q] = ch.wt[i];
+                }
+            }
+            ch = EdgeChunk();       // parsed edges are not needed any more
+        }
+    });
+    return g;
+}
+
+vector<vector<pii>> IngestedGraph::toAdjacency(int numThreads) const {
+    int n = numVertices(), T = max(1, numThreads);
+    vector<vector<pii>> adj(n);
+    parallelRun(T, [&](int t) {
+        for (int u = (long long)n * t / T; u < (long long)n * (t + 1) / T; u++) {
+            adj[u].resize(offsets[u + 1] - offsets[u]);
+            for (long long e = offsets[u]; e < offsets[u + 1]; e++)
+                adj[u][e - offsets[u]] = {neighbors[e], weights.empty() ? 1 : weights[e]};
+        }
+    });
+    return adj;
+}
+
+
+/*************************** Benchmark *****************************/
+
+// addEdge() of dijkstra.cpp
+void addEdge(vector<vector<pii>>& adj, int u, int v, int wt) {
+    adj[u].push_back({v, wt});
+    adj[v].push_back({u, wt});
+}
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [vertices] [edges] [threads] [file]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    long long m = argc > 2 ? atoll(argv[2]) : 4000000;
+    int threads = argc > 3 ? atoi(argv[3]) : max(1u, thread::hardware_concurrency());
+    string path = argc > 4 ? argv[4] : "/tmp/edge_list.txt";
+
+    // Input in the format of dijkstra.cpp: "V E", then "u v wt" per line
+    {
+        mt19937 rng(23);
+        ofstream out(path);
+        out << n << " " << m << "\n";
+        for (long long i = 0; i < m; i++) out << rng() % n << " " << rng() % n << " " << 1 + rng() % 100 << "\n";
+    }
+
+    // cin >> + addEdge like main() in dijkstra.cpp
+    vector<vector<pii>> expected;
+    double cinMs = timeMs([&] {
+        ifstream in(path);
+        int V, E;
+        in >> V >> E;
+        expected.assign(V, {});
+        for (int i = 0; i < E; i++) {
+            int u, v, wt;
+            in >> u >> v >> wt;
+            addEdge(expected, u, v, wt);
+        }
+    });
+    cout << n << " vertices, " << m << " edges\n";
+    cout << "  ifstream >> + addEdge           : " << cinMs << " ms\n";
+
+    vector<int> threadCounts = {1};
+    if (threads > 1) threadCounts.push_back(threads);
+    for (int T : threadCounts) {
+        IngestOptions opt;
+        opt.header = true;
+        opt.threads = T;
+        opt.blockBytes = 16 << 20;
+        IngestedGraph g;
+        vector<vector<pii>> adj;
+        double ingestMs = timeMs([&] { g = ingestEdgeList(path, opt); });
+        double adjMs = timeMs([&] { adj = g.toAdjacency(T); });
+        cout << "  ingest to CSR, " << T << " thread(s)        : " << ingestMs << " ms (+ " << adjMs
+             << " ms to vector<vector<pii>>)" << (adj == expected ? "" : "  DIFFERENT") << "\n";
+    }
+    remove(path.c_str());
+}
@@ -0,0 +1,350 @@
+/*
+Point to point shortest path: one source, ONE target
+Ref: https://www.cs.princeton.edu/courses/archive/spr06/cos423/Handouts/EPP%20shortest%20path%20algorithms.pdf (Goldberg, Harrelson - ALT)
+
+dijkstra() in dijkstra.cpp settles the whole graph even if only min_dist[target] is needed.
+
+1. Early exit       -> stop as soon as the target is popped from the heap (its distance is final)
+2. Bidirectional    -> one search from the source, one from the target on the reversed graph.
+                       Alternate between them, every edge touching both searches gives a candidate
+                       path. Stop when topForward + topBackward >= best candidate.
+                       Each search covers a "ball" of about HALF the radius -> far fewer settled vertices.
+3. A*               -> Dijkstra on reduced costs: pop by dist[v] + h(v), h(v) = lower bound of dist(v, target).
+                       h must be admissible (never over estimate) and consistent (h(u) <= wt(u,v) + h(v)),
+                       then the first time the target is popped its distance is exact.
+                       a) Coordinates: straight line distance (only valid when wt >= geometric length)
+                       b) Landmarks (ALT): precompute distances from a few landmarks L, triangle inequality
+                          gives dist(v,t) >= max over L of |d(L,t) - d(L,v)|, works on ANY graph
+
+All searches reuse the arrays of the class and only reset the vertices they touched,
+so a query costs O(touched log touched) and not O(V).
+Path is returned as the list of vertices from source to target (empty if unreachable).
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+const int INF = 1e9;
+
+typedef pair<int, int> pii;
+
+struct PathResult {
+    int dist = INF;
+    vector<int> path;
+    int settled = 0;        // vertices popped from the heaps (work done)
+};
+
+// h(v) = 0 -> A* is plain Dijkstra with early exit
+struct ZeroHeuristic {
+    void setTarget(int) {}
+    int operator()(int) const { return 0; }
+};
+
+// Straight line distance, scaled by the smallest weight per unit of length of the graph
+struct CoordinateHeuristic {
+    const vector<pair<double, double>>& coords;
+    double costPerUnit;
+    int t = 0;
+
+    CoordinateHeuristic(const vector<pair<double, double>>& coords, double costPerUnit)
+        : coords(coords), costPerUnit(costPerUnit) {}
+    void setTarget(int target) { t = target; }
+    int operator()(int v) const {
+        double dx = coords[v].first - coords[t].first, dy = coords[v].second - coords[t].second;
+        return (int)(sqrt(dx * dx + dy * dy) * costPerUnit);
+    }
+};
+
+// ALT: distances from and to k landmarks, picked greedily far from each other
+class LandmarkHeuristic {
+private:
+    vector<vector<int>> from, to;   // from[l][v] = d(L, v), to[l][v] = d(v, L)
+    vector<int> fromT, toT;         // same for the current target
+    int t = 0;
+
+    static vector<int> sssp(const vector<vector<pii>>& g, int src) {
+        vector<int> dist(g.size(), INF);
+        priority_queue<pii, vector<pii>, greater<pii>> pq;
+        dist[src] = 0;
+        pq.push({0, src});
+        while (!pq.empty()) {
+            auto [d, u] = pq.top();
+            pq.pop();
+            if (d > dist[u]) continue;
+            for (auto& e : g[u])
+                if (dist[e.first] > d + e.second) {
+                    dist[e.first] = d + e.second;
+                    pq.push({dist[e.first], e.first});
+                }
+        }
+        return dist;
+    }
+
+public:
+    LandmarkHeuristic(const vector<vector<pii>>& adj, const vector<vector<pii>>& radj, int k) {
+        int n = adj.size();
+        vector<int> closest(n, INF);
+        int l = 0;
+        for (int i = 0; i < k && n > 0; i++) {
+            from.push_back(sssp(adj, l));
+            to.push_back(sssp(radj, l));
+            // next landmark: reachable vertex farthest from all landmarks so far
+            for (int v = 0; v < n; v++) closest[v] = min(closest[v], from.back()[v]);
+            int best = -1;
+            for (int v = 0; v < n; v++)
+                if (closest[v] != INF && (best == -1 || closest[v] > closest[best])) best = v;
+            if (best == -1 || closest[best] == 0) break;
+            l = best;
+        }
+        fromT.resize(from.size());
+        toT.resize(from.size());
+    }
+
+    void setTarget(int target) {
+        t = target;
+        for (size_t i = 0; i < from.size(); i++) {
+            fromT[i] = from[i][t];
+            toT[i] = to[i][t];
+        }
+    }
+
+    int operator()(int v) const {
+        int h = 0;
+        for (size_t i = 0; i < from.size(); i++) {
+            // d(v,t) >= d(L,t) - d(L,v)  and  d(v,t) >= d(v,L) - d(t,L)
+            if (fromT[i] != INF && from[i][v] != INF) h = max(h, fromT[i] - from[i][v]);
+            if (to[i][v] != INF && toT[i] != INF) h = max(h, to[i][v] - toT[i]);
+        }
+        return h;
+    }
+};
+
+
+class PointToPoint {
+private:
+    const vector<vector<pii>>& adj;
+    vector<vector<pii>> radj;
+    // [0] forward search, [1] backward search
+    vector<int> dist[2], parent[2];
+    vector<char> done[2];
+    vector<int> touched[2];
+
+    void touch(int side, int v, int d, int p) {
+        if (dist[side][v] == INF) touched[side].push_back(v);
+        dist[side][v] = d;
+        parent[side][v] = p;
+    }
+
+    void reset() {
+        for (int side = 0; side < 2; side++) {
+            for (int v : touched[side]) {
+                dist[side][v] = INF;
+                parent[side][v] = -1;
+                done[side][v] = 0;
+            }
+            touched[side].clear();
+        }
+    }
+
+    // source ... target following parent[0] from target
+    vector<int> pathTo(int target) {
+        vector<int> path;
+        for (int v = target; v != -1; v = parent[0][v]) path.push_back(v);
+        reverse(path.begin(), path.end());
+        return path;
+    }
+
+public:
+    // adj[u] = {v, wt}, for an undirected graph both directions are in adj
+    PointToPoint(const vector<vector<pii>>& adj) : adj(adj), radj(adj.size()) {
+        int n = adj.size();
+        for (int u = 0; u < n; u++)
+            for (auto& e : adj[u]) radj[e.first].push_back({u, e.second});
+        for (int side = 0; side < 2; side++) {
+            dist[side].assign(n, INF);
+            parent[side].assign(n, -1);
+            done[side].assign(n, 0);
+        }
+    }
+
+    const vector<vector<pii>>& reversed() const { return radj; }
+
+    // A* with heuristic h, ZeroHeuristic gives Dijkstra with early exit
+    template <class Heuristic>
+    PathResult astar(int s, int t, Heuristic& h) {
+        PathResult res;
+        h.setTarget(t);
+        priority_queue<pii, vector<pii>, greater<pii>> pq;    // {dist + h, vertex}
+        touch(0, s, 0, -1);
+        pq.push({h(s), s});
+
+        while (!pq.empty()) {
+            int curr = pq.top().second;
+            pq.pop();
+            if (done[0][curr]) continue;
+            done[0][curr] = 1;
+            res.settled++;
+            if (curr == t) break;
+
+            for (auto& e : adj[curr]) {
+                int next = e.first, nd = dist[0][curr] + e.second;
+                if (nd < dist[0][next]) {
+                    touch(0, next, nd, curr);
+                    pq.push({nd + h(next), next});
+                }
+            }
+        }
+        if (done[0][t]) {
+            res.dist = dist[0][t];
+            res.path = pathTo(t);
+        }
+        reset();
+        return res;
+    }
+
+    PathResult bidirectional(int s, int t) {
+        PathResult res;
+        priority_queue<pii, vector<pii>, greater<pii>> pq[2];
+        touch(0, s, 0, -1);
+        touch(1, t, 0, -1);
+        pq[0].push({0, s});
+        pq[1].push({0, t});
+        int best = INF, meetF = -1, meetB = -1;     // best path = s .. meetF -> meetB .. t
+        if (s == t) best = 0, meetF = meetB = s;
+
+        while (!pq[0].empty() && !pq[1].empty()) {
+            if (pq[0].top().first + pq[1].top().first >= best) break;
+            // expand the side with the smaller heap (usually the smaller ball)
+            int side = pq[0].size() <= pq[1].size() ? 0 : 1;
+            const vector<vector<pii>>& g = side == 0 ? adj : radj;
+            auto [d, curr] = pq[side].top();
+            pq[side].pop();
+            if (done[side][curr]) continue;
+            done[side][curr] = 1;
+            res.settled++;
+
+            for (auto& e : g[curr]) {
+                int next = e.first, nd = d + e.second;
+                if (nd < dist[side][next]) {
+                    touch(side, next, nd, curr);
+                    pq[side].push({nd, next});
+                }
+                // next was reached by the other search -> candidate path
+                if (dist[1 - side][next] != INF && nd + dist[1 - side][next] < best) {
+                    best = nd + dist[1 - side][next];
+                    meetF = side == 0 ? curr : next;
+                    meetB = side == 0 ? next : curr;
+                }
+            }
+        }
+
+        if (meetF != -1) {
+            res.dist = best;
+            // forward half from parent[0], backward half from parent[1]
+            res.path = pathTo(meetF);
+            for (int v = meetB == meetF ? parent[1][meetB] : meetB; v != -1; v = parent[1][v]) res.path.push_back(v);
+        }
+        reset();
+        return res;
+    }
+};
+
+
+/*************************** Benchmark *****************************/
+
+// dijkstra() from dijkstra.cpp: settles everything
+vector<int> fullDijkstra(const vector<vector<pii>>& adj, int src) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<int> min_dist(adj.size(), INF);
+    min_dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        int curr_dist = pq.top().first;
+        int curr = pq.top().second;
+        pq.pop();
+        if (curr_dist > min_dist[curr]) continue;
+        for (auto u : adj[curr])
+            if (min_dist[u.first] > min_dist[curr] + u.second) {
+                min_dist[u.first] = min_dist[curr] + u.second;
+                pq.push({min_dist[u.first], u.first});
+            }
+    }
+    return min_dist;
+}
+
+// Length of the path, INF if some consecutive pair is not an edge
+long long pathLength(const vector<vector<pii>>& adj, const vector<int>& path) {
+    long long len = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        int best = INF;
+        for (auto& e : adj[path[i]])
+            if (e.first == path[i + 1]) best = min(best, e.second);
+        if (best == INF) return INF;
+        len += best;
+    }
+    return len;
+}
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [grid side] [queries]
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 300;
+    int Q = argc > 2 ? atoi(argv[2]) : 100;
+    int n = side * side;
+
+    // Road like grid: weight = 10 * length * random factor in [1, 2), a few random cells removed
+    mt19937 rng(16);
+    vector<pair<double, double>> coords(n);
+    vector<vector<pii>> adj(n);
+    auto addEdge = [&](int u, int v) {
+        int wt = 10 + rng() % 10;
+        adj[u].push_back({v, wt});
+        adj[v].push_back({u, wt});
+    };
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            coords[u] = {(double)c, (double)r};
+            if (rng() % 10 == 0) continue;      // blocked cell, no edges to the right / down
+            if (c + 1 < side) addEdge(u, u + 1);
+            if (r + 1 < side) addEdge(u, u + side);
+        }
+
+    PointToPoint p2p(adj);
+    ZeroHeuristic zero;
+    CoordinateHeuristic coord(coords, 10.0);
+    LandmarkHeuristic alt(adj, p2p.reversed(), 8);
+
+    vector<pii> queries(Q);
+    for (auto& q : queries) q = {(int)(rng() % n), (int)(rng() % n)};
+
+    vector<int> expected(Q);
+    double fullMs = timeMs([&] {
+        for (int i = 0; i < Q; i++) expected[i] = fullDijkstra(adj, queries[i].first)[queries[i].second];
+    });
+
+    auto report = [&](const string& name, const function<PathResult(int, int)>& run) {
+        long long settled = 0;
+        bool ok = true;
+        double ms = timeMs([&] {
+            for (int i = 0; i < Q; i++) {
+                PathResult r = run(queries[i].first, queries[i].second);
+                settled += r.settled;
+                if (r.dist != expected[i] || (r.dist != INF && pathLength(adj, r.path) != r.dist)) ok = false;
+            }
+        });
+        cout << "  " << left << setw(24) << name << ms / Q << " ms/query, " << settled / Q << " settled"
+             << (ok ? "" : "  WRONG") << "\n";
+    };
+
+    cout << side << "x" << side << " grid, " << Q << " random queries\n";
+    cout << "  " << left << setw(24) << "Full Dijkstra" << fullMs / Q << " ms/query, " << n << " settled\n";
+    report("Dijkstra early exit", [&](int s, int t) { return p2p.astar(s, t, zero); });
+    report("Bidirectional Dijkstra", [&](int s, int t) { return p2p.bidirectional(s, t); });
+    report("A* coordinates", [&](int s, int t) { return p2p.astar(s, t, coord); });
+    report("A* landmarks (8)", [&](int s, int t) { return p2p.astar(s, t, alt); });
+}
@@ -12,6 +12,10 @@ O-------A
         2
 Using dijstar's if we start from O we will have edges O-A,A-B,A-C 
 as from O-B dist = 12/15 and O-C distance = 14/13
+
+Heap here can grow to O(E) (duplicates). Decrease-key version with O(V) heap -> indexed_heap.cpp
+Kruskal / Filter-Kruskal (edge list + disjoint set) -> kruskal_algo.cpp
+Reading a huge edge list file (parallel parsing straight into CSR) -> parallel_edge_ingest.cpp
 */
 #include<bits/stdc++.h>
 #define LIM 3000
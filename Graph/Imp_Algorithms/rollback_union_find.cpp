@@ -0,0 +1,172 @@
+/*
+    Disjoint set with undo (rollback)
+    Ref: https://cp-algorithms.com/data_structures/disjoint_set_union.html#support-the-operation-of-undoing-the-last-union
+
+    find() in union_find_algo.cpp path-compresses: one call can rewrite many parent[] entries,
+    so there is no cheap way back to an older state (only copying parent / sz arrays).
+
+    Here:
+        -> union by size only, NO path compression -> tree height <= log n, find is O(log n)
+        -> every successful union changes exactly one parent[] and one sz[] entry,
+           the hung root is pushed on a history stack
+        -> checkpoint()  : current history size (a "version" of the sets)
+        -> rollback(to)  : pop unions until history size == to, O(1) per undone union
+
+    Used for offline query processing (dynamic_connectivity.cpp) and backtracking searches
+    where every branch adds some unions and must remove them when it returns.
+*/
+
+#include <bits/stdc++.h>
+
+using namespace std;
+
+class RollbackUnionFind
+{
+private:
+    vector<int> parent, sz;
+    vector<int> history; // roots that were hung below another root, in order
+    int components;
+
+public:
+    RollbackUnionFind(int n) : parent(n), sz(n, 1), components(n)
+    {
+        iota(parent.begin(), parent.end(), 0);
+    }
+
+    int find(int x) const
+    {
+        while (parent[x] != x)
+            x = parent[x];
+        return x;
+    }
+
+    // false if x and y were already in the same set (nothing to undo then)
+    bool weightedUnion(int x, int y)
+    {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+            return false;
+        if (sz[x] < sz[y])
+            swap(x, y);
+        parent[y] = x;
+        sz[x] += sz[y];
+        history.push_back(y);
+        components--;
+        return true;
+    }
+
+    size_t checkpoint() const { return history.size(); }
+
+    void rollback(size_t to)
+    {
+        while (history.size() > to)
+        {
+            int y = history.back();
+            history.pop_back();
+            sz[parent[y]] -= sz[y];
+            parent[y] = y;
+            components++;
+        }
+    }
+
+    bool isFriend(int x, int y) const { return find(x) == find(y); }
+    int size(int x) const { return sz[find(x)]; }
+    int numComponents() const { return components; }
+};
+
+
+/*************************** Backtracking example *****************************/
+
+/*
+    Two terminal reliability: count the subsets of edges in which s and t are connected.
+    Branch on every edge: take it or skip it. Taking it = one union, undone on return.
+    Once s and t are connected every way to finish the remaining edges counts.
+*/
+long long countConnectedRollback(const vector<pair<int, int>> &edges, size_t i, int s, int t, RollbackUnionFind &dsu)
+{
+    if (dsu.isFriend(s, t))
+        return 1LL << (edges.size() - i);
+    if (i == edges.size())
+        return 0;
+    size_t cp = dsu.checkpoint();
+    dsu.weightedUnion(edges[i].first, edges[i].second);
+    long long taken = countConnectedRollback(edges, i + 1, s, t, dsu);
+    dsu.rollback(cp);
+    return taken + countConnectedRollback(edges, i + 1, s, t, dsu);
+}
+
+// Same search, but every branch copies the arrays (the only option with path compression)
+struct CopyDSU
+{
+    vector<int> parent, sz;
+
+    CopyDSU(int n) : parent(n), sz(n, 1) { iota(parent.begin(), parent.end(), 0); }
+
+    int find(int x) { return parent[x] == x ? x : parent[x] = find(parent[x]); }
+
+    void weightedUnion(int x, int y)
+    {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+            return;
+        if (sz[x] < sz[y])
+            swap(x, y);
+        parent[y] = x;
+        sz[x] += sz[y];
+    }
+};
+
+long long countConnectedCopy(const vector<pair<int, int>> &edges, size_t i, int s, int t, CopyDSU &dsu)
+{
+    if (dsu.find(s) == dsu.find(t))
+        return 1LL << (edges.size() - i);
+    if (i == edges.size())
+        return 0;
+    CopyDSU with = dsu;
+    with.weightedUnion(edges[i].first, edges[i].second);
+    return countConnectedCopy(edges, i + 1, s, t, with) + countConnectedCopy(edges, i + 1, s, t, dsu);
+}
+
+double timeMs(const function<void()> &fn)
+{
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [grid side] -> edges of a side x side grid, s = top left, t = bottom right
+int main(int argc, char *argv[])
+{
+    RollbackUnionFind dsu(5);
+    dsu.weightedUnion(0, 1);
+    size_t cp = dsu.checkpoint();
+    dsu.weightedUnion(1, 2);
+    dsu.weightedUnion(3, 4);
+    cout << "isFriend(0,2) = " << dsu.isFriend(0, 2) << ", components = " << dsu.numComponents() << "\n";
+    dsu.rollback(cp);
+    cout << "after rollback isFriend(0,2) = " << dsu.isFriend(0, 2) << ", components = " << dsu.numComponents() << "\n";
+
+    int side = argc > 1 ? atoi(argv[1]) : 4;
+    int n = side * side;
+    vector<pair<int, int>> edges;
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++)
+        {
+            if (c + 1 < side)
+                edges.push_back({r * side + c, r * side + c + 1});
+            if (r + 1 < side)
+                edges.push_back({r * side + c, (r + 1) * side + c});
+        }
+
+    long long a = 0, b = 0;
+    RollbackUnionFind rb(n);
+    CopyDSU cd(n);
+    double rollbackMs = timeMs([&] { a = countConnectedRollback(edges, 0, 0, n - 1, rb); });
+    double copyMs = timeMs([&] { b = countConnectedCopy(edges, 0, 0, n - 1, cd); });
+
+    cout << "\n" << side << "x" << side << " grid, " << edges.size() << " edges: subsets connecting corners\n";
+    cout << "  Rollback     : " << rollbackMs << " ms, " << a << " subsets\n";
+    cout << "  Copy per call: " << copyMs << " ms, " << b << " subsets" << (a == b ? "" : "  DIFFERENT") << "\n";
+}
@@ -0,0 +1,362 @@
+/*
+Weighted graph with fast hasEdge / getWeight + triangle counting
+WeightedGraph in graph1.cpp stores vertex -> vector of (neighbor, weight) in insertion order, so
+hasEdge / getWeight walk the whole list: O(degree) per query, and the hubs of a social / web graph
+have degrees in the thousands.
+
+SortedWeightedGraph (same interface as WeightedGraph):
+    -> every vertex keeps its neighbor ids SORTED in one array and the weights in a parallel array,
+       so a search only touches the 4 byte ids (16 per cache line)
+    -> search = branchless binary search down to a window of 16 ids, then a branch free count of the
+       ids smaller than the key over the window (a loop the compiler turns into SIMD compares)
+       -> O(log degree)
+    -> vertices with at least HUB_DEGREE neighbors also get an open addressing hash table
+       (linear probing, power of 2 size >= 2 * degree, slot -> position in the sorted array)
+       -> O(1) expected, one or two cache lines
+    -> addEdge only appends; a vertex is sorted (and its hash built) the first time it is queried
+       after a change. Stable sort, so with parallel edges the FIRST one added wins, as in graph1.cpp
+    -> ids are arbitrary ints like graph1.cpp: one hash lookup for the first vertex, the neighbor
+       is searched by its id directly
+
+countTriangles(): orient every edge from the endpoint with lower (degree, id) to the higher one,
+every triangle is then found exactly once as u -> v, u -> w, v -> w, i.e. |out(u) ∩ out(v)| for every
+edge u -> v, intersected by merging the sorted lists. Out degrees are at most sqrt(2E)
+-> O(E sqrt(E)) instead of a hasEdge per wedge.
+*/
+#include <bits/stdc++.h>
+using namespace std;
+
+typedef pair<int, int> pii;
+
+class SortedWeightedGraph {
+private:
+    static const int HUB_DEGREE = 64;
+    static const int WINDOW = 16;
+
+    struct Vertex {
+        vector<int> nbr;            // neighbor ids, sorted unless dirty
+        vector<int> wt;             // weights parallel to nbr
+        vector<int> slots;          // hubs only: open addressing, slot -> index in nbr or -1
+        bool dirty = false;
+    };
+
+    unordered_map<int, Vertex> adjList;
+    bool directed;
+
+    static unsigned slotOf(int key, size_t mask) {
+        unsigned h = (unsigned)key * 0x9E3779B1u;       // Fibonacci hashing
+        return (h ^ (h >> 16)) & mask;
+    }
+
+    static void prepare(Vertex& x) {
+        if (!x.dirty) return;
+        x.dirty = false;
+        size_t d = x.nbr.size();
+        vector<int> idx(d);
+        iota(idx.begin(), idx.end(), 0);
+        stable_sort(idx.begin(), idx.end(), [&](int a, int b) { return x.nbr[a] < x.nbr[b]; });
+        vector<int> nbr(d), wt(d);
+        for (size_t i = 0; i < d; i++) {
+            nbr[i] = x.nbr[idx[i]];
+            wt[i] = x.wt[idx[i]];
+        }
+        x.nbr.swap(nbr);
+        x.wt.swap(wt);
+
+        x.slots.clear();
+        if (d < HUB_DEGREE) return;
+        size_t cap = 1;
+        while (cap < 2 * d) cap <<= 1;
+        x.slots.assign(cap, -1);
+        for (size_t i = 0; i < d; i++) {
+            if (i > 0 && x.nbr[i] == x.nbr[i - 1]) continue;     // keep the first of parallel edges
+            size_t s = slotOf(x.nbr[i], cap - 1);
+            while (x.slots[s] != -1) s = (s + 1) & (cap - 1);
+            x.slots[s] = (int)i;
+        }
+    }
+
+    // index of the first occurrence of key in x.nbr, -1 if absent (x must be prepared)
+    static int find(const Vertex& x, int key) {
+        if (!x.slots.empty()) {
+            size_t mask = x.slots.size() - 1;
+            for (size_t s = slotOf(key, mask);; s = (s + 1) & mask) {
+                int i = x.slots[s];
+                if (i == -1) return -1;
+                if (x.nbr[i] == key) return i;
+            }
+        }
+        const int* a = x.nbr.data();
+        int lo = 0, len = (int)x.nbr.size();
+        while (len > WINDOW) {              // lower bound, no unpredictable branch
+            int half = len / 2;
+            lo = a[lo + half - 1] < key ? lo + half : lo;
+            len -= half;
+        }
+        int below = 0;
+        for (int i = 0; i < len; i++) below += a[lo + i] < key;
+        int i = lo + below;
+        return i < (int)x.nbr.size() && a[i] == key ? i : -1;
+    }
+
+    Vertex* vertex(int v) {
+        auto it = adjList.find(v);
+        if (it == adjList.end()) return nullptr;
+        prepare(it->second);
+        return &it->second;
+    }
+
+public:
+    // Constructor
+    SortedWeightedGraph(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    // Add a vertex
+    void addVertex(int vertex) {
+        adjList[vertex];
+    }
+
+    // Add a weighted edge, O(1): the list is sorted at the next query on the vertex
+    void addEdge(int v1, int v2, int weight) {
+        Vertex& a = adjList[v1];
+        a.nbr.push_back(v2);
+        a.wt.push_back(weight);
+        a.dirty = true;
+        Vertex& b = adjList[v2];
+        if (!directed) {
+            b.nbr.push_back(v1);
+            b.wt.push_back(weight);
+            b.dirty = true;
+        }
+    }
+
+    // Get all vertices
+    vector<int> getVertices() {
+        vector<int> vertices;
+        for (auto& entry : adjList) {
+            vertices.push_back(entry.first);
+        }
+        return vertices;
+    }
+
+    // Neighbors with their weights, sorted by neighbor id
+    vector<pair<int, int>> getNeighbors(int v) {
+        vector<pair<int, int>> result;
+        if (Vertex* x = vertex(v))
+            for (size_t i = 0; i < x->nbr.size(); i++) result.push_back({x->nbr[i], x->wt[i]});
+        return result;
+    }
+
+    int degree(int v) {
+        Vertex* x = vertex(v);
+        return x ? (int)x->nbr.size() : 0;
+    }
+
+    // Check if an edge exists
+    bool hasEdge(int v1, int v2) {
+        Vertex* x = vertex(v1);
+        return x && find(*x, v2) != -1;
+    }
+
+    // Get weight of an edge (returns -1 if edge doesn't exist)
+    int getWeight(int v1, int v2) {
+        Vertex* x = vertex(v1);
+        if (!x) return -1;
+        int i = find(*x, v2);
+        return i == -1 ? -1 : x->wt[i];
+    }
+
+    // Undirected triangles (self loops and parallel edges ignored)
+    long long countTriangles() {
+        // dense rank by (degree, id), out lists = neighbors of higher rank, sorted by rank
+        vector<int> ids = getVertices();
+        int n = ids.size();
+        vector<int> deg(n);
+        for (int i = 0; i < n; i++) deg[i] = degree(ids[i]);
+        vector<int> byRank(n);
+        iota(byRank.begin(), byRank.end(), 0);
+        sort(byRank.begin(), byRank.end(), [&](int a, int b) { return pii(deg[a], ids[a]) < pii(deg[b], ids[b]); });
+        unordered_map<int, int> rankOf;
+        rankOf.reserve(n);
+        for (int r = 0; r < n; r++) rankOf[ids[byRank[r]]] = r;
+
+        vector<long long> offsets(n + 1, 0);
+        vector<int> out;
+        for (int r = 0; r < n; r++) {
+            const Vertex& x = adjList[ids[byRank[r]]];
+            size_t start = out.size();
+            for (int v : x.nbr) {
+                int rv = rankOf[v];
+                if (rv > r) out.push_back(rv);
+            }
+            sort(out.begin() + start, out.end());
+            out.erase(unique(out.begin() + start, out.end()), out.end());
+            offsets[r + 1] = out.size();
+        }
+
+        long long triangles = 0;
+        for (int u = 0; u < n; u++)
+            for (long long e = offsets[u]; e < offsets[u + 1]; e++) {
+                int v = out[e];
+                const int *a = &out[0] + offsets[u], *aEnd = &out[0] + offsets[u + 1];
+                const int *b = &out[0] + offsets[v], *bEnd = &out[0] + offsets[v + 1];
+                while (a != aEnd && b != bEnd) {
+                    if (*a < *b)
+                        a++;
+                    else if (*b < *a)
+                        b++;
+                    else {
+                        triangles++;
+                        a++;
+                        b++;
+                    }
+                }
+            }
+        return triangles;
+    }
+};
+
+
+/*************************** Benchmark *****************************/
+
+// WeightedGraph from graph1.cpp (the parts used here)
+class WeightedGraph {
+private:
+    unordered_map<int, vector<pair<int, int>>> adjList; // vertex -> list of (neighbor, weight)
+    bool directed;
+
+public:
+    WeightedGraph(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    void addVertex(int vertex) {
+        if (adjList.find(vertex) == adjList.end()) {
+            adjList[vertex] = vector<pair<int, int>>();
+        }
+    }
+
+    void addEdge(int v1, int v2, int weight) {
+        addVertex(v1);
+        addVertex(v2);
+        adjList[v1].push_back({v2, weight});
+        if (!directed) {
+            adjList[v2].push_back({v1, weight});
+        }
+    }
+
+    vector<int> getVertices() {
+        vector<int> vertices;
+        for (auto& entry : adjList) {
+            vertices.push_back(entry.first);
+        }
+        return vertices;
+    }
+
+    vector<pair<int, int>> getNeighbors(int vertex) {
+        if (adjList.find(vertex) != adjList.end()) {
+            return adjList[vertex];
+        }
+        return vector<pair<int, int>>();
+    }
+
+    bool hasEdge(int v1, int v2) {
+        if (adjList.find(v1) == adjList.end()) return false;
+
+        for (auto& neighborPair : adjList[v1]) {
+            if (neighborPair.first == v2) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int getWeight(int v1, int v2) {
+        if (adjList.find(v1) == adjList.end()) return -1;
+
+        for (auto& neighborPair : adjList[v1]) {
+            if (neighborPair.first == v2) {
+                return neighborPair.second;
+            }
+        }
+        return -1;
+    }
+};
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+// Usage: ./a.out [vertices] [edges] [queries]
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 50000;
+    int m = argc > 2 ? atoi(argv[2]) : 400000;
+    int Q = argc > 3 ? atoi(argv[3]) : 1000000;
+    mt19937 rng(25);
+
+    // Skewed degrees: one endpoint of an edge is u^3 (mostly small ids), ids are spread out (x 7 + 3)
+    auto pick = [&] {
+        double u = rng() / 4294967296.0;
+        return (int)(u * u * u * n) * 7 + 3;
+    };
+    WeightedGraph wg;
+    SortedWeightedGraph sg;
+    vector<array<int, 3>> edges(m);
+    for (auto& e : edges) {
+        e = {pick(), (int)(rng() % n) * 7 + 3, 1 + (int)(rng() % 100)};
+        if (e[0] == e[1]) e[1] += 7;
+    }
+    double buildW = timeMs([&] { for (auto& e : edges) wg.addEdge(e[0], e[1], e[2]); });
+    double buildS = timeMs([&] {
+        for (auto& e : edges) sg.addEdge(e[0], e[1], e[2]);
+        sg.hasEdge(edges[0][0], edges[0][1]);       // sorts the first vertex only, the rest sort lazily
+    });
+
+    // Half the queries are edges, half are random pairs; the first endpoint is often a hub
+    vector<pii> queries(Q);
+    for (auto& q : queries) {
+        if (rng() % 2) {
+            auto& e = edges[rng() % m];
+            q = rng() % 2 ? pii(e[0], e[1]) : pii(e[1], e[0]);
+        } else {
+            q = {pick(), (int)(rng() % n) * 7 + 3};
+        }
+    }
+
+    long long sumW = 0, sumS = 0;
+    double warm = timeMs([&] { for (int v : sg.getVertices()) sg.degree(v); });
+    double hasW = timeMs([&] { for (auto& q : queries) sumW += wg.hasEdge(q.first, q.second); });
+    double hasS = timeMs([&] { for (auto& q : queries) sumS += sg.hasEdge(q.first, q.second); });
+    double wtW = timeMs([&] { for (auto& q : queries) sumW += wg.getWeight(q.first, q.second); });
+    double wtS = timeMs([&] { for (auto& q : queries) sumS += sg.getWeight(q.first, q.second); });
+
+    cout << "Graph: " << n << " vertices, " << m << " edges, max degree ";
+    int maxDeg = 0;
+    for (int v : sg.getVertices()) maxDeg = max(maxDeg, sg.degree(v));
+    cout << maxDeg << ", " << Q << " queries\n";
+    cout << "  build           WeightedGraph " << buildW << " ms, SortedWeightedGraph " << buildS
+         << " ms (+ " << warm << " ms sorting / hashing on first use)\n";
+    cout << "  hasEdge         WeightedGraph " << hasW << " ms, SortedWeightedGraph " << hasS << " ms\n";
+    cout << "  getWeight       WeightedGraph " << wtW << " ms, SortedWeightedGraph " << wtS << " ms"
+         << (sumW == sumS ? "" : "  DIFFERENT") << "\n";
+
+    // Triangles: hasEdge per wedge (v, w both after u) vs sorted intersection
+    long long triW = 0, triS = 0;
+    double triWMs = timeMs([&] {
+        for (int u : wg.getVertices()) {
+            vector<int> later;
+            for (auto& p : wg.getNeighbors(u))
+                if (p.first > u) later.push_back(p.first);
+            sort(later.begin(), later.end());
+            later.erase(unique(later.begin(), later.end()), later.end());
+            for (size_t i = 0; i < later.size(); i++)
+                for (size_t j = i + 1; j < later.size(); j++) triW += wg.hasEdge(later[i], later[j]);
+        }
+    });
+    double triSMs = timeMs([&] { triS = sg.countTriangles(); });
+    cout << "  triangles       hasEdge per wedge " << triWMs << " ms, sorted intersection " << triSMs << " ms ("
+         << triS << " triangles)" << (triW == triS ? "" : "  DIFFERENT") << "\n";
+}
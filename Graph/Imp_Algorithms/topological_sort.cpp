@@ -13,6 +13,8 @@
 // do bfs and which ever element we visit reduce its indegree 
 // keep on checking while reducing indegree and if its zero add... REPEAT 
 
+// Graph with cycles? Squash every SCC into one node first -> strongly_connected_components.cpp
+
 #include<bits/stdc++.h>
 #define LIM 3000
 #define INF 1e5+3
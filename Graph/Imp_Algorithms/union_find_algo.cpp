@@ -6,6 +6,9 @@
         : m is the number of operations being performed on this dijoint set
     https://leetcode.com/problems/the-earliest-moment-when-everyone-become-friends
     Ref: https://www.youtube.com/watch?v=Kptz-NVA2RE
+    Multi threaded (lock-free) version -> concurrent_union_find.cpp
+    With unFriend(a,b) as well (friendships can end) -> dynamic_connectivity.cpp
+    Undo unions (checkpoint / rollback, no path compression) -> rollback_union_find.cpp
 */
 
 #include <bits/stdc++.h>
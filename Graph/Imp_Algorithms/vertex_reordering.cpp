@@ -0,0 +1,589 @@
+/*
+Vertex reordering for cache locality (RCM / degree sort / Gorder-lite)
+Ref: Cuthill, McKee "Reducing the bandwidth of sparse symmetric matrices"
+Ref: Wei, Yu, Lu, Lin "Speedup Graph Processing by Graph Ordering" (Gorder)
+
+BFS / Dijkstra spend their time on visited[v] / dist[v] for the neighbors v of the current vertex.
+The ids coming out of graph1.cpp / graph2.cpp are whatever the input used (or hash order of the
+unordered_map), so neighbors are scattered over the whole array -> almost every access is a cache miss.
+Relabeling the vertices so that neighbors get close ids turns those into hits. The graph is the same,
+only the names change: perm.order[newId] = oldId, perm.rank[oldId] = newId translate results back.
+
+1. Degree descending: hubs get the smallest ids -> the few vertices touched most often share cache lines.
+   Counting sort, O(V + E).
+2. Reverse Cuthill-McKee: BFS from a pseudo peripheral vertex (a few BFS sweeps, low degree end of the
+   longest path found), neighbors of each vertex numbered in increasing degree, whole order reversed.
+   Every edge joins vertices of the same or adjacent BFS levels, which now have close ids
+   (small bandwidth). Great for meshes / road networks. O(V + E log d)
+3. Gorder-lite: greedy, next vertex = the unplaced vertex sharing the most with the last w placed ones
+   (score = edges to them + common neighbors with them, like Gorder). When a vertex enters / leaves the
+   window the scores of its neighbors and of its neighbors' neighbors change by 1. Neighbors with more
+   than sqrt(V) neighbors are skipped for the common neighbor part (hubs link everything, as in the
+   paper). Max score through lazy buckets (Gorder's unit heap idea). O(sum of deg^2), good for
+   clustered (social) graphs.
+
+freeze() takes the WeightedGraph or Graph of graph1.cpp, or the unordered_map<int, vector<int>> adjList
+of the Graph classes in graph2.cpp (unweighted graphs get weight 1 on every edge).
+
+locality = mean |rank[u] - rank[v]| over all edges (smaller is better), a number that does not need
+hardware counters. Cache misses are read from perf_event_open when the machine exposes them.
+*/
+#include <bits/stdc++.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+using namespace std;
+
+typedef pair<int, int> pii;
+
+// WeightedGraph from graph1.cpp (vertex -> list of (neighbor, weight)), kept here for freeze()
+class WeightedGraph {
+private:
+    unordered_map<int, vector<pair<int, int>>> adjList;
+    bool directed;
+
+public:
+    WeightedGraph(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    void addVertex(int vertex) {
+        if (adjList.find(vertex) == adjList.end()) {
+            adjList[vertex] = vector<pair<int, int>>();
+        }
+    }
+
+    void addEdge(int v1, int v2, int weight) {
+        addVertex(v1);
+        addVertex(v2);
+        adjList[v1].push_back({v2, weight});
+        if (!directed) {
+            adjList[v2].push_back({v1, weight});
+        }
+    }
+
+    vector<int> getVertices() {
+        vector<int> vertices;
+        for (auto& entry : adjList) {
+            vertices.push_back(entry.first);
+        }
+        return vertices;
+    }
+
+    const vector<pair<int, int>>& getNeighbors(int vertex) {
+        static const vector<pair<int, int>> empty;
+        auto it = adjList.find(vertex);
+        return it == adjList.end() ? empty : it->second;
+    }
+};
+
+// Graph from graph1.cpp (vertex -> list of neighbors), kept here for freeze()
+class Graph {
+private:
+    unordered_map<int, list<int>> adjList;
+    bool directed;
+
+public:
+    Graph(bool isDirected = false) {
+        directed = isDirected;
+    }
+
+    void addVertex(int vertex) {
+        if (adjList.find(vertex) == adjList.end()) {
+            adjList[vertex] = list<int>();
+        }
+    }
+
+    void addEdge(int v1, int v2) {
+        addVertex(v1);
+        addVertex(v2);
+        adjList[v1].push_back(v2);
+        if (!directed) {
+            adjList[v2].push_back(v1);
+        }
+    }
+
+    vector<int> getVertices() {
+        vector<int> vertices;
+        for (auto& entry : adjList) {
+            vertices.push_back(entry.first);
+        }
+        return vertices;
+    }
+
+    const list<int>& getNeighbors(int vertex) {
+        static const list<int> empty;
+        auto it = adjList.find(vertex);
+        return it == adjList.end() ? empty : it->second;
+    }
+};
+
+
+// CSR with dense ids 0..n-1 (same layout as CSRGraph in CSR_graph.cpp)
+struct WeightedCSR {
+    vector<long long> offsets;
+    vector<int> neighbors, weights;
+    vector<int> idOf;               // dense id -> id used in the WeightedGraph
+
+    int numVertices() const { return (int)offsets.size() - 1; }
+    int degree(int u) const { return (int)(offsets[u + 1] - offsets[u]); }
+};
+
+// Dense ids in getVertices() order, i.e. the hash order of the unordered_map
+WeightedCSR freeze(WeightedGraph& graph) {
+    WeightedCSR g;
+    g.idOf = graph.getVertices();
+    int n = g.idOf.size();
+    unordered_map<int, int> indexOf;
+    indexOf.reserve(n);
+    for (int i = 0; i < n; i++) indexOf[g.idOf[i]] = i;
+
+    g.offsets.assign(n + 1, 0);
+    for (int u = 0; u < n; u++) g.offsets[u + 1] = g.offsets[u] + graph.getNeighbors(g.idOf[u]).size();
+    g.neighbors.resize(g.offsets[n]);
+    g.weights.resize(g.offsets[n]);
+    for (int u = 0; u < n; u++) {
+        long long p = g.offsets[u];
+        for (auto& [v, wt] : graph.getNeighbors(g.idOf[u])) {
+            g.neighbors[p] = indexOf[v];
+            g.weights[p++] = wt;
+        }
+    }
+    return g;
+}
+
+// Unweighted graphs: every edge gets weight 1 (Dijkstra on the result = BFS distances)
+template <class NeighborsOf>
+WeightedCSR freezeUnweighted(vector<int> ids, NeighborsOf neighborsOf) {
+    WeightedCSR g;
+    g.idOf = move(ids);
+    int n = g.idOf.size();
+    unordered_map<int, int> indexOf;
+    indexOf.reserve(n);
+    for (int i = 0; i < n; i++) indexOf[g.idOf[i]] = i;
+
+    g.offsets.assign(n + 1, 0);
+    for (int u = 0; u < n; u++) g.offsets[u + 1] = g.offsets[u] + neighborsOf(g.idOf[u]).size();
+    g.neighbors.resize(g.offsets[n]);
+    g.weights.assign(g.offsets[n], 1);
+    for (int u = 0; u < n; u++) {
+        long long p = g.offsets[u];
+        for (int v : neighborsOf(g.idOf[u])) g.neighbors[p++] = indexOf[v];
+    }
+    return g;
+}
+
+// Graph of graph1.cpp
+WeightedCSR freeze(Graph& graph) {
+    return freezeUnweighted(graph.getVertices(), [&](int v) -> const list<int>& { return graph.getNeighbors(v); });
+}
+
+// The adjList of the Graph classes in graph2.cpp. Their addEdge only creates u, so a vertex that only
+// appears as a neighbor gets its id after all the keys.
+WeightedCSR freeze(const unordered_map<int, vector<int>>& adjList) {
+    vector<int> ids;
+    unordered_set<int> known;
+    for (auto& entry : adjList) {
+        ids.push_back(entry.first);
+        known.insert(entry.first);
+    }
+    for (auto& entry : adjList)
+        for (int v : entry.second)
+            if (known.insert(v).second) ids.push_back(v);
+
+    static const vector<int> empty;
+    return freezeUnweighted(move(ids), [&](int v) -> const vector<int>& {
+        auto it = adjList.find(v);
+        return it == adjList.end() ? empty : it->second;
+    });
+}
+
+
+struct Permutation {
+    vector<int> order;      // new id -> old id
+    vector<int> rank;       // old id -> new id
+
+    static Permutation fromOrder(vector<int> order) {
+        Permutation p;
+        p.rank.resize(order.size());
+        for (int i = 0; i < (int)order.size(); i++) p.rank[order[i]] = i;
+        p.order = move(order);
+        return p;
+    }
+
+    // values indexed by new id -> the same values indexed by old id
+    template <class T>
+    vector<T> toOld(const vector<T>& byNew) const {
+        vector<T> byOld(byNew.size());
+        for (size_t i = 0; i < byNew.size(); i++) byOld[order[i]] = byNew[i];
+        return byOld;
+    }
+};
+
+// Same graph with vertex perm.order[i] renamed to i, every neighbor list sorted by new id
+WeightedCSR relabel(const WeightedCSR& g, const Permutation& perm) {
+    int n = g.numVertices();
+    WeightedCSR r;
+    r.offsets.assign(n + 1, 0);
+    r.idOf.resize(n);
+    for (int i = 0; i < n; i++) {
+        r.offsets[i + 1] = r.offsets[i] + g.degree(perm.order[i]);
+        r.idOf[i] = g.idOf[perm.order[i]];
+    }
+    r.neighbors.resize(r.offsets[n]);
+    r.weights.resize(r.offsets[n]);
+    vector<pii> tmp;
+    for (int i = 0; i < n; i++) {
+        int u = perm.order[i];
+        tmp.clear();
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) tmp.push_back({perm.rank[g.neighbors[e]], g.weights[e]});
+        sort(tmp.begin(), tmp.end());
+        for (size_t k = 0; k < tmp.size(); k++) {
+            r.neighbors[r.offsets[i] + k] = tmp[k].first;
+            r.weights[r.offsets[i] + k] = tmp[k].second;
+        }
+    }
+    return r;
+}
+
+
+/*************************** Orderings *****************************/
+
+Permutation identityOrder(const WeightedCSR& g) {
+    vector<int> order(g.numVertices());
+    iota(order.begin(), order.end(), 0);
+    return Permutation::fromOrder(order);
+}
+
+Permutation degreeOrder(const WeightedCSR& g) {
+    int n = g.numVertices(), maxDeg = 0;
+    for (int u = 0; u < n; u++) maxDeg = max(maxDeg, g.degree(u));
+    vector<int> start(maxDeg + 2, 0), order(n);
+    for (int u = 0; u < n; u++) start[maxDeg - g.degree(u) + 1]++;
+    for (int d = 0; d <= maxDeg; d++) start[d + 1] += start[d];
+    for (int u = 0; u < n; u++) order[start[maxDeg - g.degree(u)]++] = u;     // stable
+    return Permutation::fromOrder(order);
+}
+
+Permutation rcmOrder(const WeightedCSR& g) {
+    int n = g.numVertices();
+    vector<int> order, level(n, -1), byDegree = degreeOrder(g).order;
+    reverse(byDegree.begin(), byDegree.end());      // lowest degree first
+    vector<char> placed(n, 0);
+    order.reserve(n);
+
+    // BFS over the unplaced vertices, returns the last level (level[] is scratch)
+    vector<int> q, touched;
+    auto sweep = [&](int s) {
+        for (int v : touched) level[v] = -1;
+        touched.assign(1, s);
+        level[s] = 0;
+        q.assign(1, s);
+        for (size_t head = 0; head < q.size(); head++) {
+            int u = q[head];
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int v = g.neighbors[e];
+                if (!placed[v] && level[v] == -1) {
+                    level[v] = level[u] + 1;
+                    touched.push_back(v);
+                    q.push_back(v);
+                }
+            }
+        }
+        return level[q.back()];
+    };
+
+    vector<int> next;
+    for (int s0 : byDegree) {
+        while (!placed[s0]) {     // a while: in a directed graph the peripheral vertex may not reach s0
+            // pseudo peripheral vertex: low degree end of the deepest BFS, while the depth grows
+            int s = s0, depth = sweep(s);
+            for (int iter = 0; iter < 4; iter++) {
+                int far = -1;
+                for (int i = (int)q.size() - 1; i >= 0 && level[q[i]] == depth; i--)
+                    if (far == -1 || g.degree(q[i]) < g.degree(far)) far = q[i];
+                int d = sweep(far);
+                s = far;
+                if (d <= depth) break;
+                depth = d;
+            }
+
+            // Cuthill-McKee: BFS, children in increasing degree
+            size_t head = order.size();
+            placed[s] = 1;
+            order.push_back(s);
+            for (; head < order.size(); head++) {
+                int u = order[head];
+                next.clear();
+                for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++)
+                    if (!placed[g.neighbors[e]]) {
+                        placed[g.neighbors[e]] = 1;
+                        next.push_back(g.neighbors[e]);
+                    }
+                sort(next.begin(), next.end(), [&](int a, int b) { return g.degree(a) < g.degree(b); });
+                order.insert(order.end(), next.begin(), next.end());
+            }
+        }
+    }
+    reverse(order.begin(), order.end());
+    return Permutation::fromOrder(order);
+}
+
+Permutation gorderLite(const WeightedCSR& g, int window = 5) {
+    int n = g.numVertices();
+    int hubLimit = max(8, (int)sqrt((double)n));
+    vector<int> score(n, 0), order, byDegree = degreeOrder(g).order;
+    vector<char> placed(n, 0);
+    // bucket[s] = vertices pushed with score s (entries may be stale), scores are small ints
+    // so push is O(1) and the max only moves down between pushes
+    vector<vector<int>> bucket(1);
+    int top = 0;
+    order.reserve(n);
+
+    auto bump = [&](int v, int delta) {
+        if (placed[v]) return;
+        score[v] += delta;
+        if (delta < 0) return;
+        if (score[v] >= (int)bucket.size()) bucket.resize(score[v] + 1);
+        bucket[score[v]].push_back(v);
+        top = max(top, score[v]);
+    };
+    // u enters (+1) or leaves (-1) the window
+    auto update = [&](int u, int delta) {
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int x = g.neighbors[e];
+            bump(x, delta);
+            if (g.degree(x) > hubLimit) continue;
+            for (long long f = g.offsets[x]; f < g.offsets[x + 1]; f++)
+                if (g.neighbors[f] != u) bump(g.neighbors[f], delta);
+        }
+    };
+
+    size_t fallback = 0;        // next vertex in degree order, used when no candidate has a score
+    while ((int)order.size() < n) {
+        int u = -1;
+        while (u == -1 && top > 0) {
+            if (bucket[top].empty()) {
+                top--;
+                continue;
+            }
+            int v = bucket[top].back();
+            bucket[top].pop_back();
+            if (placed[v] || score[v] > top) continue;      // placed, or a newer entry is higher up
+            if (score[v] == top)
+                u = v;
+            else if (score[v] > 0)
+                bucket[score[v]].push_back(v);              // score went down
+        }
+        if (u == -1) {
+            while (placed[byDegree[fallback]]) fallback++;
+            u = byDegree[fallback];
+        }
+
+        placed[u] = 1;
+        order.push_back(u);
+        update(u, +1);
+        if ((int)order.size() > window) update(order[order.size() - 1 - window], -1);
+    }
+    return Permutation::fromOrder(order);
+}
+
+// mean |id(u) - id(v)| over all edges
+double locality(const WeightedCSR& g) {
+    double sum = 0;
+    for (int u = 0; u < g.numVertices(); u++)
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) sum += abs(u - g.neighbors[e]);
+    return g.neighbors.empty() ? 0 : sum / g.neighbors.size();
+}
+
+
+/*************************** Traversals *****************************/
+
+// BFS of graph2.cpp, returns the BFS level of every vertex (-1 = unreachable)
+vector<int> bfsLevels(const WeightedCSR& g, int src) {
+    vector<int> level(g.numVertices(), -1), q;
+    q.reserve(g.numVertices());
+    level[src] = 0;
+    q.push_back(src);
+    for (size_t head = 0; head < q.size(); head++) {
+        int u = q[head];
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++)
+            if (level[g.neighbors[e]] == -1) {
+                level[g.neighbors[e]] = level[u] + 1;
+                q.push_back(g.neighbors[e]);
+            }
+    }
+    return level;
+}
+
+// dijkstra of graph2.cpp, INT_MAX = unreachable
+vector<int> dijkstra(const WeightedCSR& g, int src) {
+    priority_queue<pii, vector<pii>, greater<pii>> pq;
+    vector<int> dist(g.numVertices(), INT_MAX);
+    dist[src] = 0;
+    pq.push({0, src});
+    while (!pq.empty()) {
+        auto [d, u] = pq.top();
+        pq.pop();
+        if (d > dist[u]) continue;
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int v = g.neighbors[e];
+            if (d + g.weights[e] < dist[v]) {
+                dist[v] = d + g.weights[e];
+                pq.push({dist[v], v});
+            }
+        }
+    }
+    return dist;
+}
+
+
+/*************************** Benchmark *****************************/
+
+// Hardware cache miss counter of this process, ok() is false if the machine / container has none
+class CacheMissCounter {
+private:
+    int fd = -1;
+
+public:
+    CacheMissCounter() {
+        perf_event_attr pe;
+        memset(&pe, 0, sizeof(pe));
+        pe.type = PERF_TYPE_HARDWARE;
+        pe.size = sizeof(pe);
+        pe.config = PERF_COUNT_HW_CACHE_MISSES;
+        pe.disabled = 1;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+        fd = syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+    }
+    ~CacheMissCounter() {
+        if (fd != -1) close(fd);
+    }
+
+    bool ok() const { return fd != -1; }
+
+    long long count(const function<void()>& fn) {
+        if (!ok()) {
+            fn();
+            return -1;
+        }
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        fn();
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long misses = -1;
+        if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) misses = -1;
+        return misses;
+    }
+};
+
+double timeMs(const function<void()>& fn) {
+    auto t = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t).count();
+}
+
+void benchmark(const string& name, WeightedGraph& graph) {
+    WeightedCSR base = freeze(graph);
+    int src = 0;        // dense id 0 (some vertex of the WeightedGraph)
+    vector<int> levels = bfsLevels(base, src), dist = dijkstra(base, src);
+    CacheMissCounter counter;
+    cout << name << ": " << base.numVertices() << " vertices, " << base.neighbors.size() / 2 << " edges"
+         << (counter.ok() ? "" : "  (no hardware cache counters here, misses n/a)") << "\n";
+
+    vector<pair<string, function<Permutation(const WeightedCSR&)>>> orderings = {
+        {"input (hash) order", identityOrder},
+        {"degree descending ", degreeOrder},
+        {"RCM               ", rcmOrder},
+        {"Gorder-lite       ", [](const WeightedCSR& g) { return gorderLite(g); }},
+    };
+    for (auto& [label, make] : orderings) {
+        Permutation perm;
+        WeightedCSR g;
+        double orderMs = timeMs([&] { perm = make(base); });
+        double relabelMs = timeMs([&] { g = relabel(base, perm); });
+        vector<int> l, d;
+        double bfsMs = 0, dijMs = 0;
+        long long bfsMiss = counter.count([&] { bfsMs = timeMs([&] { l = bfsLevels(g, perm.rank[src]); }); });
+        long long dijMiss = counter.count([&] { dijMs = timeMs([&] { d = dijkstra(g, perm.rank[src]); }); });
+        bool same = perm.toOld(l) == levels && perm.toOld(d) == dist;
+
+        auto misses = [](long long m) { return m < 0 ? string("n/a") : to_string(m); };
+        cout << "  " << label << ": reorder " << fixed << setprecision(1) << orderMs + relabelMs
+             << " ms, locality " << locality(g) << ", BFS " << bfsMs << " ms (misses " << misses(bfsMiss)
+             << "), Dijkstra " << dijMs << " ms (misses " << misses(dijMiss) << ")"
+             << (same ? "" : "  DIFFERENT") << "\n";
+        cout.unsetf(ios::fixed);
+    }
+}
+
+// Usage: ./a.out [grid side] [clustered vertices]
+int main(int argc, char* argv[]) {
+    int side = argc > 1 ? atoi(argv[1]) : 700;
+    int clustered = argc > 2 ? atoi(argv[2]) : 300000;
+    mt19937 rng(24);
+
+    // Road like: side x side grid with shuffled ids (the ids say nothing about position)
+    {
+        int n = side * side;
+        vector<int> id(n);
+        iota(id.begin(), id.end(), 0);
+        shuffle(id.begin(), id.end(), rng);
+        WeightedGraph graph;
+        for (int r = 0; r < side; r++)
+            for (int c = 0; c < side; c++) {
+                if (c + 1 < side) graph.addEdge(id[r * side + c], id[r * side + c + 1], 1 + rng() % 100);
+                if (r + 1 < side) graph.addEdge(id[r * side + c], id[(r + 1) * side + c], 1 + rng() % 100);
+            }
+        benchmark("Grid " + to_string(side) + "x" + to_string(side), graph);
+
+        // same grid as a graph1.cpp Graph and as a graph2.cpp adjList (edges right / down only).
+        // From the corner id[0] every version must give level r + c after RCM + BFS.
+        Graph plain;
+        unordered_map<int, vector<int>> adjList;
+        for (int r = 0; r < side; r++)
+            for (int c = 0; c < side; c++) {
+                int u = id[r * side + c];
+                if (c + 1 < side) {
+                    plain.addEdge(u, id[r * side + c + 1]);
+                    adjList[u].push_back(id[r * side + c + 1]);
+                }
+                if (r + 1 < side) {
+                    plain.addEdge(u, id[(r + 1) * side + c]);
+                    adjList[u].push_back(id[(r + 1) * side + c]);
+                }
+            }
+        auto cornerLevelsOk = [&](const WeightedCSR& base) {
+            Permutation perm = rcmOrder(base);
+            WeightedCSR g = relabel(base, perm);
+            int src = 0;
+            while (base.idOf[src] != id[0]) src++;
+            vector<int> l = perm.toOld(bfsLevels(g, perm.rank[src])), byId(n, -1);
+            for (int u = 0; u < base.numVertices(); u++) byId[base.idOf[u]] = l[u];
+            for (int k = 0; k < n; k++)
+                if (byId[id[k]] != k / side + k % side) return false;
+            return base.numVertices() == n;
+        };
+        cout << "  Graph of graph1.cpp, freeze + RCM: " << (cornerLevelsOk(freeze(plain)) ? "same levels" : "DIFFERENT")
+             << "\n";
+        cout << "  adjList of graph2.cpp, freeze + RCM: " << (cornerLevelsOk(freeze(adjList)) ? "same levels" : "DIFFERENT")
+             << "\n";
+    }
+
+    // Social like: communities of 64 with dense inside, a few random edges between them, shuffled ids
+    {
+        int n = clustered;
+        vector<int> id(n);
+        iota(id.begin(), id.end(), 0);
+        shuffle(id.begin(), id.end(), rng);
+        WeightedGraph graph;
+        for (int u = 0; u < n; u++) {
+            int base = u / 64 * 64, size = min(64, n - base);
+            for (int k = 0; k < 4; k++) graph.addEdge(id[u], id[base + rng() % size], 1 + rng() % 100);
+            if (rng() % 4 == 0) graph.addEdge(id[u], id[rng() % n], 1 + rng() % 100);
+        }
+        benchmark("Clustered (64 per community)", graph);
+    }
+}
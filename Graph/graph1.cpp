@@ -78,7 +78,9 @@ Pattern 26: Graph - Union-Find (Disjoint Set Union - DSU)                      2
 --> Graph Representation: The graph uses an adjacency list, implemented via unordered_map<int, list<int>> for efficient storage and lookup.
 --> Directed vs Undirected: The constructor allows flexibility to create either type.
 --> Edge Addition: Automatically creates vertices if they are not already present.
---> Duplicate Edge Prevention: getEdges uses a set to avoid counting duplicate edges in undirected graphs */
+--> Duplicate Edge Prevention: getEdges uses a set to avoid counting duplicate edges in undirected graphs
+--> For large static graphs freeze it into a CSR graph (see Imp_Algorithms/CSR_graph.cpp)
+--> Relabel vertices for cache locality: Imp_Algorithms/vertex_reordering.cpp (freeze gives every edge weight 1) */
 #include <bits/stdc++.h>
 using namespace std;
 class Graph {
@@ -118,7 +120,18 @@ public:
         return vertices;
     }
 
-    // Get all edges 
+    // Get neighbors of a vertex (empty list if vertex doesn't exist)
+    const list<int>& getNeighbors(int vertex) {
+        static const list<int> empty;
+        auto it = adjList.find(vertex);
+        return it == adjList.end() ? empty : it->second;
+    }
+
+    bool isDirected() {
+        return directed;
+    }
+
+    // Get all edges
     vector<pair<int, int>> getEdges() {
         vector<pair<int, int>> edges;
         set<pair<int, int>> seen; // to avoid duplicates in undirected graph
@@ -168,6 +181,8 @@ public:
 --> Directed vs Undirected:
      -> If the graph is undirected, edges are bidirectionally added with the same weight.
 --> Edge Weight: Weights can represent costs, distances, or capacities depending on the problem.
+--> Big graphs with arbitrary ids: relabel vertices for cache locality (see Imp_Algorithms/vertex_reordering.cpp)
+--> hasEdge / getWeight scan the list (O(degree)). Sorted lists + hash for hubs, triangle counting: Imp_Algorithms/sorted_weighted_graph.cpp
  */
 #include <bits/stdc++.h>
 using namespace std;
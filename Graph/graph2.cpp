@@ -50,7 +50,8 @@ public:
 --> Visited Tracking:
     -> unordered_set ensures each node is visited only once.
 --> Adjacency List:
-    -> Efficient for sparse graphs and common use cases.*/
+    -> Efficient for sparse graphs and common use cases.
+    -> Big graphs with arbitrary ids: freeze(adjList) + relabel for cache locality (see Imp_Algorithms/vertex_reordering.cpp)*/
 #include <bits/stdc++.h>
 using namespace std;
 class Graph {
@@ -115,7 +115,8 @@ int main() {
 ---> Uses unordered_map for the graph to handle arbitrary node numbers.
 ---> Uses DFS recursively to find all nodes connected to a given starting node.
 ---> Unvisited nodes are used as entry points to identify new components.
----> Each connected component is stored as a vector and collected into the result.*/
+---> Each connected component is stored as a vector and collected into the result.
+---> For huge graphs: parallel version returning one label array -> Imp_Algorithms/parallel_connected_components.cpp*/
 #include <bits/stdc++.h>
 using namespace std;
 void dfs(int vertex, unordered_map<int, vector<int>>& graph, unordered_set<int>& visited, vector<int>& component) {
@@ -10,85 +10,105 @@
 
 
 #include<bits/stdc++.h>
-const int LIM = (int)2e5+3;
 
 using namespace std;
 
-// elements of trees are stored from 0
-vector<int> tree[LIM];
-vector<int> parent(LIM);
-vector<int> depth(LIM);
-// up(i,j) stores element 2^j steps above (element)i. 
-int up[LIM][20];
-
-void addEdge(int u, int v) 
+void addEdge(vector<vector<int>>& tree, int u, int v) 
 { 
     tree[u].push_back(v);
     tree[v].push_back(u);
 }
 
-// Precomputes the up using dp.
-void  binary_lifting(int u, int pa)
+// flat up[u*LOG + j] table sized from n, explicit stack dfs (deep trees don't overflow)
+class BinaryLifting
 {
-    // up by 2^0 steps
-    up[u][0] = pa;
-
-    for(int i=1;i<20;i++)
+private:
+    int LOG = 1;
+    // up(i,j) stores element 2^j steps above (element)i. 
+    vector<int> up;
+    vector<int> depth;
+    vector<int> stck;
+
+public:
+    // elements of trees are stored from 0
+    void build(const vector<vector<int>>& tree, int root)
     {
-        if(up[u][i-1] != -1)
-            up[u][i] = up[ up[u][i-1] ][i-1];
-        else
-            up[u][i] = -1;
+        int n = tree.size();
+        LOG = 1;
+        while((1 << LOG) < n)
+            LOG++;
+        up.assign((size_t)n * LOG, -1);
+        depth.assign(n, 0);
+
+        // Vanilla dfs, parent is always finished before its children
+        stck.assign(1, root);
+        while(!stck.empty())
+        {
+            int u = stck.back();
+            stck.pop_back();
+            int pa = up[(size_t)u * LOG];
+
+            for(int i=1;i<LOG;i++)
+            {
+                if(up[(size_t)u * LOG + i-1] != -1)
+                    up[(size_t)u * LOG + i] = up[(size_t)up[(size_t)u * LOG + i-1] * LOG + i-1];
+            }
+
+            for(auto v: tree[u])
+                if(v != pa)
+                {
+                    up[(size_t)v * LOG] = u;     // up by 2^0 steps
+                    depth[v] = depth[u] + 1;
+                    stck.push_back(v);
+                }
+        }
     }
 
-    // Vanilla dfs
-    for(auto v: tree[u])
-        if(v != pa)
-            binary_lifting(v,u);    
-}
-
-// returns the node_val at dist h above node
-// if no node is present returns -1
-int getKthAncestor(int node, int h)
-{
-    // node should not be -1
-    for(int i=0;i<20 and node != -1;i++)
+    // returns the node_val at dist h above node
+    // if no node is present returns -1
+    int getKthAncestor(int node, int h) const
     {
-        // if ith bit of h is set
-        if(h & 1<<i)
-            node = up[node][i];
+        if(h >= (1 << LOG))
+            return -1;
+        // node should not be -1
+        for(int i=0;i<LOG and node != -1;i++)
+        {
+            // if ith bit of h is set
+            if(h & 1<<i)
+                node = up[(size_t)node * LOG + i];
+        }
+        return node;
     }
-    return node;
-}
 
-// returns Lowest common Ancestor for nodes a,b
-int LCA(int a, int b)
-{
-    if(depth[a] < depth[b])
-        swap(a,b);
-    
-    int diff = depth[a] - depth[b];
+    // returns Lowest common Ancestor for nodes a,b
+    int LCA(int a, int b) const
+    {
+        if(depth[a] < depth[b])
+            swap(a,b);
+        
+        int diff = depth[a] - depth[b];
 
-    // move a diff levels up till both a and b are not on same level
-    a = getKthAncestor(a,diff);
+        // move a diff levels up till both a and b are not on same level
+        a = getKthAncestor(a,diff);
 
-    // imp condition
-    if(a == b)
-        return a;
+        // imp condition
+        if(a == b)
+            return a;
 
-    // move up by 2^k steps only if on moving 2^k steps up a is not equals b.
-    for(int k=19;k>=0;k--)
-    {
-        if(up[a][k] != up[b][k])
+        // move up by 2^k steps only if on moving 2^k steps up a is not equals b.
+        for(int k=LOG-1;k>=0;k--)
         {
-            a = up[a][k];
-            b = up[b][k];
+            if(up[(size_t)a * LOG + k] != up[(size_t)b * LOG + k])
+            {
+                a = up[(size_t)a * LOG + k];
+                b = up[(size_t)b * LOG + k];
+            }
         }
-    }
 
-    // we have reached one level below of LCA
-    return up[a][0];
-}
+        // we have reached one level below of LCA
+        return up[(size_t)a * LOG];
+    }
+};
 
 int main()
 {
@@ -97,15 +117,17 @@ int main()
     cout<<"Enter number of vertices: ";
     cin>>V;
     
+    vector<vector<int>> tree(V);
     for(i=0;i<V-1;i++)
     {
         cout<<i+1<<". Enter vertex name u and v:  ";
         cin>>u>>v;
-        addEdge(u,v);
+        addEdge(tree,u,v);
     }
    
     src = 0;
-    binary_lifting(src,-1);
+    BinaryLifting bl;
+    bl.build(tree,src);
 
     cout<<"Enter number of queries: ";
     cin>>q;
@@ -113,7 +135,7 @@ int main()
     for(i=0;i<q;i++)
     {
         cin >> x >> k;
-        cout << "Node :" << getKthAncestor(x,k) << " is at a dist " 
+        cout << "Node :" << bl.getKthAncestor(x,k) << " is at a dist " 
         << k << "from " << x << endl;
     }
 }
\ No newline at end of file